@@ -0,0 +1,256 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of the heap allocation counter used by the benchmarks.
+//=============================================================================
+
+#include "allocation_counter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+/// The number of allocations made so far. Constant initialized, so it can be used by
+/// allocations made before main.
+static std::atomic<quint64> allocation_count(0);
+
+quint64 AllocationCount()
+{
+    return allocation_count.load(std::memory_order_relaxed);
+}
+
+#if defined(__GLIBC__)
+
+// Interpose the C allocator, forwarding to glibc's own implementation. Qt's containers
+// allocate with malloc, and libstdc++'s operator new calls it too, including the nothrow
+// forms. The aligned forms of operator new call aligned_alloc.
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+extern "C" void* __libc_memalign(size_t alignment, size_t size);
+
+extern "C" void* malloc(size_t size) noexcept
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) noexcept
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* pointer, size_t size) noexcept
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(pointer, size);
+}
+
+extern "C" void* memalign(size_t alignment, size_t size) noexcept
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" void* aligned_alloc(size_t alignment, size_t size) noexcept
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" int posix_memalign(void** pointer, size_t alignment, size_t size) noexcept
+{
+    // The alignment must be a power of two multiple of the pointer size.
+    if (alignment == 0 || alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+    {
+        return EINVAL;
+    }
+
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    void* aligned_pointer = __libc_memalign(alignment, size);
+    if (aligned_pointer == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    *pointer = aligned_pointer;
+    return 0;
+}
+
+#else
+
+void* operator new(std::size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    Q_UNUSED(tag);
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t size) noexcept
+{
+    Q_UNUSED(size);
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t size) noexcept
+{
+    Q_UNUSED(size);
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t& tag) noexcept
+{
+    Q_UNUSED(tag);
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t& tag) noexcept
+{
+    Q_UNUSED(tag);
+    std::free(pointer);
+}
+
+#if defined(__cpp_aligned_new)
+
+/// Allocate aligned memory without counting it or throwing.
+/// \param size The size of the allocation.
+/// \param alignment The alignment of the allocation.
+/// \return The allocation, or nullptr if there isn't enough memory.
+static void* AlignedMalloc(std::size_t size, std::align_val_t alignment)
+{
+    size = (size == 0) ? 1 : size;
+
+#if defined(_WIN32)
+    return _aligned_malloc(size, static_cast<std::size_t>(alignment));
+#else
+    // posix_memalign needs at least pointer alignment; larger alignments are already powers of two.
+    void* pointer = nullptr;
+    if (posix_memalign(&pointer, std::max(static_cast<std::size_t>(alignment), sizeof(void*)), size) != 0)
+    {
+        return nullptr;
+    }
+    return pointer;
+#endif
+}
+
+/// Free memory from AlignedMalloc().
+/// \param pointer The allocation.
+static void AlignedFree(void* pointer)
+{
+#if defined(_WIN32)
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    void* pointer = AlignedMalloc(size, alignment);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    Q_UNUSED(tag);
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return AlignedMalloc(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, alignment, tag);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept
+{
+    Q_UNUSED(alignment);
+    AlignedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept
+{
+    Q_UNUSED(alignment);
+    AlignedFree(pointer);
+}
+
+void operator delete(void* pointer, std::size_t size, std::align_val_t alignment) noexcept
+{
+    Q_UNUSED(size);
+    Q_UNUSED(alignment);
+    AlignedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t size, std::align_val_t alignment) noexcept
+{
+    Q_UNUSED(size);
+    Q_UNUSED(alignment);
+    AlignedFree(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    Q_UNUSED(alignment);
+    Q_UNUSED(tag);
+    AlignedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    Q_UNUSED(alignment);
+    Q_UNUSED(tag);
+    AlignedFree(pointer);
+}
+
+#endif
+
+#endif
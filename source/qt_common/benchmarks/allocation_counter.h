@@ -0,0 +1,22 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for the heap allocation counter used by the benchmarks.
+//=============================================================================
+
+#ifndef QTCOMMON_BENCHMARKS_ALLOCATION_COUNTER_H_
+#define QTCOMMON_BENCHMARKS_ALLOCATION_COUNTER_H_
+
+#include <QtGlobal>
+
+/// Get the number of heap allocations the process has made so far.
+///
+/// With glibc, malloc, calloc, realloc and the aligned allocators (memalign, posix_memalign and
+/// aligned_alloc) are counted, which includes Qt's containers and every form of operator new.
+/// Elsewhere every form of the global operator new is counted, including the nothrow and aligned
+/// forms, but memory allocated directly with the C allocator, as Qt's containers do, is not.
+/// \return The number of allocations.
+quint64 AllocationCount();
+
+#endif  // QTCOMMON_BENCHMARKS_ALLOCATION_COUNTER_H_
@@ -0,0 +1,303 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Entry point for the offscreen paint benchmarks of the custom widgets.
+///
+/// Usage: qt_common_benchmarks [--output <file>] [--iterations <count>]
+///
+/// Each widget is painted at several sizes and scale factors, and the time and number of
+/// heap allocations per paint are written out as JSON, to stdout unless a file is given.
+/// Individual code paths, such as drawing the ruler ticks, are measured at a single size,
+/// and code that doesn't paint, such as formatting clocks, is timed per call.
+//=============================================================================
+
+#include <cstdio>
+
+#include <QApplication>
+#include <QColor>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QGraphicsScene>
+#include <QPainter>
+#include <QRandomGenerator>
+#include <QStringList>
+#include <QVector>
+#include <QWidget>
+
+#include "qt_common/custom_widgets/arrow_icon_combo_box.h"
+#include "qt_common/custom_widgets/colored_legend_scene.h"
+#include "qt_common/custom_widgets/completion_bar_widget.h"
+#include "qt_common/custom_widgets/donut_pie_widget.h"
+#include "qt_common/custom_widgets/file_loading_widget.h"
+#include "qt_common/custom_widgets/ruler_widget.h"
+#include "qt_common/custom_widgets/timeline_view.h"
+#include "qt_common/utils/qt_util.h"
+
+#include "allocation_counter.h"
+#include "paint_benchmark.h"
+
+/// The number of clocks covered by the ruler and the timeline.
+static const qint64 kMaxClock = 1000000000;
+
+/// The number of events shown on the timeline.
+static const int kTimelineEventCount = 200000;
+
+/// The number of items in the combo box list.
+static const int kComboBoxItemCount = 10000;
+
+/// The number of clocks formatted by each call of the clock formatting benchmarks.
+static const int kClockFormatCount = 1000;
+
+/// The width the ruler is laid out at for the tick benchmarks. Ticks are 5 to 10 pixels
+/// apart, so this gives about 10,000 ticks.
+static const int kRulerTickBenchmarkWidth = 75000;
+
+/// Measure the ruler, which is a graphics item, in a scene sized to each benchmark size.
+/// \param benchmark The benchmark to run it with.
+static void RunRulerWidget(PaintBenchmark& benchmark)
+{
+    RulerConfig config;
+    config.max_time            = kMaxClock;
+    config.time_to_clock_ratio = 1.0;
+    config.unit_type           = kTimeUnitTypeClk;
+
+    QGraphicsScene scene;
+    RulerWidget*   ruler = new RulerWidget(config);
+    scene.addItem(ruler);
+
+    auto prepare = [&scene, ruler, &config](const QSize& size) {
+        config.width  = size.width();
+        config.height = size.height();
+        ruler->Update(config);
+        ruler->UpdateVisibleBounds(0, kMaxClock);
+        scene.setSceneRect(ruler->boundingRect());
+    };
+    benchmark.RunScene("RulerWidget", &scene, prepare);
+}
+
+/// Measure the timeline with a large number of events summarized by its level-of-detail item.
+/// \param benchmark The benchmark to run it with.
+static void RunTimelineView(PaintBenchmark& benchmark)
+{
+    QVector<TimelineLodEvent> events;
+    events.reserve(kTimelineEventCount);
+
+    // A fixed seed, so every run paints the same events.
+    QRandomGenerator generator(1);
+    const qint64     spacing = kMaxClock / kTimelineEventCount;
+    for (int i = 0; i < kTimelineEventCount; i++)
+    {
+        TimelineLodEvent event;
+        event.clock    = i * spacing;
+        event.duration = generator.bounded(static_cast<int>(spacing * 4)) + 1;
+        events.append(event);
+    }
+
+    TimelineView view(nullptr);
+    view.SetMaxClock(kMaxClock);
+    view.SetLevelOfDetailEvents(events);
+    benchmark.RunWidget("TimelineView", &view);
+}
+
+/// Measure the donut pie chart.
+/// \param benchmark The benchmark to run it with.
+static void RunDonutPieWidget(PaintBenchmark& benchmark)
+{
+    static const QColor       kColors[]     = {Qt::red, Qt::green, Qt::blue, Qt::yellow};
+    static const unsigned int kSegmentCount = sizeof(kColors) / sizeof(kColors[0]);
+
+    DonutPieWidget donut(nullptr);
+    donut.SetNumSegments(kSegmentCount);
+    for (unsigned int i = 0; i < kSegmentCount; i++)
+    {
+        donut.SetIndexValue(i, 10 * (i + 1));
+        donut.SetIndexColor(i, kColors[i]);
+        donut.SetIndexText(i, QString("Segment %1").arg(i));
+    }
+    donut.SetTextLineOne("1.5 GB");
+    donut.SetTextLineTwo("of 4 GB");
+    benchmark.RunWidget("DonutPieWidget", &donut);
+}
+
+/// Measure the completion bar.
+/// \param benchmark The benchmark to run it with.
+static void RunCompletionBarWidget(PaintBenchmark& benchmark)
+{
+    CompletionBarWidget completion_bar;
+    completion_bar.SetFillPercentage(60);
+    benchmark.RunWidget("CompletionBarWidget", &completion_bar);
+}
+
+/// Measure the combo box button, with a virtualized list of many items.
+/// \param benchmark The benchmark to run it with.
+static void RunArrowIconComboBox(PaintBenchmark& benchmark)
+{
+    QStringList item_texts;
+    item_texts.reserve(kComboBoxItemCount);
+    for (int i = 0; i < kComboBoxItemCount; i++)
+    {
+        item_texts.append(QString("Queue %1").arg(i));
+    }
+
+    QWidget            main_parent;
+    ArrowIconComboBox* combo_box = new ArrowIconComboBox(&main_parent);
+    combo_box->SetVirtualized(true);
+    combo_box->InitSingleSelect(&main_parent, "Queue", false);
+    combo_box->AddItems(item_texts);
+    combo_box->SetSelectedRow(kComboBoxItemCount / 2);
+    benchmark.RunWidget("ArrowIconComboBox", combo_box);
+}
+
+/// Measure the file loading animation.
+/// \param benchmark The benchmark to run it with.
+static void RunFileLoadingWidget(PaintBenchmark& benchmark)
+{
+    FileLoadingWidget file_loading;
+    benchmark.RunWidget("FileLoadingWidget", &file_loading);
+}
+
+/// Measure the colored legend, which is a graphics scene.
+/// \param benchmark The benchmark to run it with.
+static void RunColoredLegendScene(PaintBenchmark& benchmark)
+{
+    static const QColor kColors[] = {Qt::red, Qt::green, Qt::blue, Qt::yellow, Qt::cyan, Qt::magenta, Qt::gray, Qt::darkRed};
+
+    ColoredLegendScene legend;
+    for (const QColor& color : kColors)
+    {
+        legend.AddColorLegendItem(color, color.name());
+    }
+    legend.Update();
+    benchmark.RunScene("ColoredLegendScene", &legend);
+}
+
+/// Measure drawing the ruler ticks with a single drawLines call, and with a call per tick.
+/// \param benchmark The benchmark to run it with.
+static void RunRulerTicks(PaintBenchmark& benchmark)
+{
+    auto paint = [](QPainter* painter, const QRectF& rect) {
+        // Lay the ruler out at its full width, then scale it down to the image, so that
+        // every tick is rasterized rather than clipped.
+        const QRectF ruler_rect(0, 0, kRulerTickBenchmarkWidth, rect.height());
+        painter->scale(rect.width() / ruler_rect.width(), 1.0);
+        RulerWidget::PaintRuler(painter, ruler_rect, kMaxClock, 0, kMaxClock, 1.0, kTimeUnitTypeClk);
+    };
+
+    const bool batched_tick_drawing = RulerWidget::IsBatchedTickDrawingEnabled();
+    RulerWidget::SetBatchedTickDrawing(true);
+    benchmark.RunPainter("RulerTicksBatched", paint);
+    RulerWidget::SetBatchedTickDrawing(false);
+    benchmark.RunPainter("RulerTicksPerTick", paint);
+    RulerWidget::SetBatchedTickDrawing(batched_tick_drawing);
+}
+
+/// Measure formatting a column of clocks for each time unit, through the QString, buffer and
+/// batch forms of QtUtils::ClockToTimeUnit. The Stream results format clocks with a fraction,
+/// which only the QTextStream fallback handles, for comparison with the integer paths.
+/// \param benchmark The benchmark to run it with.
+static void RunClockFormatting(PaintBenchmark& benchmark)
+{
+    static const struct
+    {
+        int         unit_type;
+        const char* name;
+    } kUnits[] = {{kTimeUnitTypeClk, "clk"},
+                  {kTimeUnitTypeNanosecond, "ns"},
+                  {kTimeUnitTypeMicrosecond, "us"},
+                  {kTimeUnitTypeMillisecond, "ms"},
+                  {kTimeUnitTypeSecond, "s"}};
+
+    QVector<double> clocks(kClockFormatCount);
+    QVector<double> fractional_clocks(kClockFormatCount);
+    for (int i = 0; i < kClockFormatCount; i++)
+    {
+        clocks[i]            = static_cast<double>(static_cast<qint64>(i) * (kMaxClock / kClockFormatCount));
+        fractional_clocks[i] = clocks[i] + 0.5;
+    }
+
+    QVector<QString> strings(kClockFormatCount);
+    QChar            buffer[QtCommon::QtUtils::kTimeUnitBufferSize];
+
+    for (const auto& unit : kUnits)
+    {
+        const int     unit_type = unit.unit_type;
+        const QString suffix    = QString("/%1").arg(unit.name);
+
+        benchmark.RunFunction("ClockToTimeUnitStream" + suffix, [&]() {
+            for (int i = 0; i < kClockFormatCount; i++)
+            {
+                strings[i] = QtCommon::QtUtils::ClockToTimeUnit(fractional_clocks[i], unit_type);
+            }
+        });
+        benchmark.RunFunction("ClockToTimeUnitString" + suffix, [&]() {
+            for (int i = 0; i < kClockFormatCount; i++)
+            {
+                strings[i] = QtCommon::QtUtils::ClockToTimeUnit(clocks[i], unit_type);
+            }
+        });
+        benchmark.RunFunction("ClockToTimeUnitBuffer" + suffix, [&]() {
+            for (int i = 0; i < kClockFormatCount; i++)
+            {
+                QtCommon::QtUtils::ClockToTimeUnit(clocks[i], unit_type, buffer, QtCommon::QtUtils::kTimeUnitBufferSize);
+            }
+        });
+        benchmark.RunFunction("ClockToTimeUnitBatch" + suffix,
+                              [&]() { QtCommon::QtUtils::ClockToTimeUnit(clocks.constData(), kClockFormatCount, unit_type, strings.data()); });
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // Paint without a display, so the results don't depend on the window system.
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM") == true)
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Measures offscreen paint performance of the qt_common custom widgets.");
+    parser.addHelpOption();
+    const QCommandLineOption output_option("output", "Write the JSON results to <file> rather than stdout.", "file");
+    const QCommandLineOption iterations_option("iterations", "The number of timed paints per size and scale factor.", "count");
+    parser.addOption(output_option);
+    parser.addOption(iterations_option);
+    parser.process(app);
+
+    PaintBenchmark benchmark;
+    benchmark.SetAllocationCounter(AllocationCount);
+    if (parser.isSet(iterations_option) == true)
+    {
+        benchmark.SetIterations(parser.value(iterations_option).toInt());
+    }
+
+    RunRulerWidget(benchmark);
+    RunTimelineView(benchmark);
+    RunDonutPieWidget(benchmark);
+    RunCompletionBarWidget(benchmark);
+    RunArrowIconComboBox(benchmark);
+    RunFileLoadingWidget(benchmark);
+    RunColoredLegendScene(benchmark);
+
+    // The rest measure a single code path, at one size.
+    benchmark.SetSizes({QSize(1920, 32)});
+    RunRulerTicks(benchmark);
+    RunClockFormatting(benchmark);
+
+    const QByteArray json = benchmark.ToJson();
+    if (parser.isSet(output_option) == false)
+    {
+        fwrite(json.constData(), 1, static_cast<size_t>(json.size()), stdout);
+        return 0;
+    }
+
+    QFile file(parser.value(output_option));
+    if (file.open(QIODevice::WriteOnly | QIODevice::Truncate) == false || file.write(json) != json.size())
+    {
+        fprintf(stderr, "Failed to write %s\n", qPrintable(file.fileName()));
+        return 1;
+    }
+    return 0;
+}
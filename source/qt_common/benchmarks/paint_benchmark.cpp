@@ -0,0 +1,190 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of a utility that measures offscreen paint performance.
+//=============================================================================
+
+#include "paint_benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QElapsedTimer>
+#include <QGraphicsScene>
+#include <QImage>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPainter>
+#include <QWidget>
+
+/// The default number of timed paints per size and scale factor.
+static const int kDefaultIterations = 50;
+
+PaintBenchmark::PaintBenchmark()
+    : iterations_(kDefaultIterations)
+    , sizes_({QSize(200, 24), QSize(800, 200), QSize(1920, 400)})
+    , scale_factors_({1.0, 1.5, 2.0})
+{
+}
+
+PaintBenchmark::~PaintBenchmark()
+{
+}
+
+void PaintBenchmark::SetIterations(int iterations)
+{
+    iterations_ = std::max(1, iterations);
+}
+
+void PaintBenchmark::SetSizes(const QVector<QSize>& sizes)
+{
+    sizes_ = sizes;
+}
+
+void PaintBenchmark::SetScaleFactors(const QVector<qreal>& scale_factors)
+{
+    scale_factors_ = scale_factors;
+}
+
+void PaintBenchmark::SetAllocationCounter(const AllocationCounter& allocation_counter)
+{
+    allocation_counter_ = allocation_counter;
+}
+
+void PaintBenchmark::RunWidget(const QString& name, QWidget* widget)
+{
+    if (widget == nullptr)
+    {
+        return;
+    }
+
+    auto prepare = [widget](const QSize& size) { widget->resize(size); };
+    auto paint   = [widget](QImage& image) { widget->render(&image); };
+    Run(name, prepare, paint);
+}
+
+void PaintBenchmark::RunScene(const QString& name, QGraphicsScene* scene, const std::function<void(const QSize&)>& prepare)
+{
+    if (scene == nullptr)
+    {
+        return;
+    }
+
+    auto prepare_scene = [prepare](const QSize& size) {
+        if (prepare != nullptr)
+        {
+            prepare(size);
+        }
+    };
+    auto paint = [scene](QImage& image) {
+        const QRectF target(0, 0, image.width() / image.devicePixelRatio(), image.height() / image.devicePixelRatio());
+        const QRectF source(scene->sceneRect().topLeft(), target.size());
+        QPainter     painter(&image);
+        scene->render(&painter, target, source);
+    };
+    Run(name, prepare_scene, paint);
+}
+
+void PaintBenchmark::RunPainter(const QString& name, const std::function<void(QPainter*, const QRectF&)>& paint)
+{
+    if (paint == nullptr)
+    {
+        return;
+    }
+
+    auto prepare       = [](const QSize& size) { Q_UNUSED(size); };
+    auto paint_painter = [paint](QImage& image) {
+        const QRectF rect(0, 0, image.width() / image.devicePixelRatio(), image.height() / image.devicePixelRatio());
+        QPainter     painter(&image);
+        paint(&painter, rect);
+    };
+    Run(name, prepare, paint_painter);
+}
+
+void PaintBenchmark::Run(const QString& name, const std::function<void(const QSize&)>& prepare, const PaintFunction& paint)
+{
+    for (const QSize& size : sizes_)
+    {
+        prepare(size);
+
+        for (qreal scale_factor : scale_factors_)
+        {
+            QImage image(QSize((int)std::ceil(size.width() * scale_factor), (int)std::ceil(size.height() * scale_factor)), QImage::Format_ARGB32_Premultiplied);
+            image.setDevicePixelRatio(scale_factor);
+
+            // The first paint fills caches, so it is not timed.
+            image.fill(Qt::transparent);
+            paint(image);
+
+            results_.append(Measure(name, size, scale_factor, [&paint, &image]() { paint(image); }));
+        }
+    }
+}
+
+void PaintBenchmark::RunFunction(const QString& name, const std::function<void()>& function)
+{
+    if (function == nullptr)
+    {
+        return;
+    }
+
+    // The first call fills caches, so it is not timed.
+    function();
+
+    results_.append(Measure(name, QSize(), 1.0, function));
+}
+
+PaintBenchmark::Result PaintBenchmark::Measure(const QString& name, const QSize& size, qreal scale_factor, const std::function<void()>& function) const
+{
+    const quint64 first_allocation = (allocation_counter_ != nullptr) ? allocation_counter_() : 0;
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < iterations_; i++)
+    {
+        function();
+    }
+    const qint64 elapsed_ns = timer.nsecsElapsed();
+
+    Result result;
+    result.name                  = name;
+    result.size                  = size;
+    result.scale_factor          = scale_factor;
+    result.iterations            = iterations_;
+    result.ns_per_paint          = elapsed_ns / iterations_;
+    result.allocations_per_paint = (allocation_counter_ != nullptr) ? (qint64)((allocation_counter_() - first_allocation) / iterations_) : -1;
+    return result;
+}
+
+const QVector<PaintBenchmark::Result>& PaintBenchmark::Results() const
+{
+    return results_;
+}
+
+void PaintBenchmark::Clear()
+{
+    results_.clear();
+}
+
+QByteArray PaintBenchmark::ToJson() const
+{
+    QJsonArray results;
+    for (const Result& result : results_)
+    {
+        QJsonObject object;
+        object["name"]                  = result.name;
+        object["width"]                 = result.size.width();
+        object["height"]                = result.size.height();
+        object["scale_factor"]          = result.scale_factor;
+        object["iterations"]            = result.iterations;
+        object["ns_per_paint"]          = result.ns_per_paint;
+        object["allocations_per_paint"] = result.allocations_per_paint;
+        results.append(object);
+    }
+
+    QJsonObject root;
+    root["results"] = results;
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
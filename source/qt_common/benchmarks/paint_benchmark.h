@@ -0,0 +1,127 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for a utility that measures offscreen paint performance.
+//=============================================================================
+
+#ifndef QTCOMMON_BENCHMARKS_PAINT_BENCHMARK_H_
+#define QTCOMMON_BENCHMARKS_PAINT_BENCHMARK_H_
+
+#include <functional>
+
+#include <QByteArray>
+#include <QSize>
+#include <QString>
+#include <QVector>
+
+class QGraphicsScene;
+class QPainter;
+class QRectF;
+class QWidget;
+
+/// Class that measures how long widgets and graphics scenes take to paint.
+///
+/// Each widget or scene is rendered into a QImage at every configured size and scale
+/// factor, so it runs with the offscreen platform plugin (QT_QPA_PLATFORM=offscreen).
+/// Results can be written out as JSON, to compare against earlier runs.
+class PaintBenchmark
+{
+public:
+    /// Function returning the total number of allocations made so far by the process.
+    typedef std::function<quint64()> AllocationCounter;
+
+    /// The measurements for one widget at one size and scale factor.
+    struct Result
+    {
+        QString name;                   ///< The name the widget or scene was run under.
+        QSize   size;                   ///< The logical size it was painted at.
+        qreal   scale_factor;           ///< The device pixel ratio it was painted at.
+        int     iterations;             ///< The number of timed paints.
+        qint64  ns_per_paint;           ///< The average time per paint, in nanoseconds.
+        qint64  allocations_per_paint;  ///< The average allocations per paint, or -1 if not counted.
+    };
+
+    /// Constructor.
+    PaintBenchmark();
+
+    /// Destructor.
+    ~PaintBenchmark();
+
+    /// Set the number of timed paints per size and scale factor.
+    /// \param iterations The number of paints.
+    void SetIterations(int iterations);
+
+    /// Set the logical sizes to paint at.
+    /// \param sizes The sizes.
+    void SetSizes(const QVector<QSize>& sizes);
+
+    /// Set the scale factors to paint at.
+    /// \param scale_factors The device pixel ratios.
+    void SetScaleFactors(const QVector<qreal>& scale_factors);
+
+    /// Set the function used to count allocations. Allocations are only reported when
+    /// one is set, for example by an application that replaces the global operator new.
+    /// \param allocation_counter The function, or nullptr to stop counting.
+    void SetAllocationCounter(const AllocationCounter& allocation_counter);
+
+    /// Measure painting a widget. The widget is resized to each configured size.
+    /// \param name The name to report the results under.
+    /// \param widget The widget to paint.
+    void RunWidget(const QString& name, QWidget* widget);
+
+    /// Measure painting a graphics scene. The area of the scene at the top left of its scene
+    /// rect is painted unscaled, at each configured size.
+    /// \param name The name to report the results under.
+    /// \param scene The scene to paint.
+    /// \param prepare Called with each size before it is measured, to lay out the scene. May be nullptr.
+    void RunScene(const QString& name, QGraphicsScene* scene, const std::function<void(const QSize&)>& prepare = nullptr);
+
+    /// Measure a paint function, for code that paints directly rather than through a widget.
+    /// \param name The name to report the results under.
+    /// \param paint Paints into the given logical rect with the painter.
+    void RunPainter(const QString& name, const std::function<void(QPainter*, const QRectF&)>& paint);
+
+    /// Measure a function that doesn't paint, such as formatting the text a widget paints.
+    /// It is run once, at no size and a scale factor of 1, and ns_per_paint is the time per call.
+    /// \param name The name to report the results under.
+    /// \param function The function to call.
+    void RunFunction(const QString& name, const std::function<void()>& function);
+
+    /// Get the results of all runs so far.
+    /// \return The results.
+    const QVector<Result>& Results() const;
+
+    /// Discard the results of all runs so far.
+    void Clear();
+
+    /// Get the results of all runs so far as a JSON document.
+    /// \return The indented JSON text.
+    QByteArray ToJson() const;
+
+private:
+    /// Function that paints the widget or scene once into an image.
+    typedef std::function<void(QImage&)> PaintFunction;
+
+    /// Measure a paint function at every size and scale factor.
+    /// \param name The name to report the results under.
+    /// \param prepare Called with each size before it is measured.
+    /// \param paint Paints into the image.
+    void Run(const QString& name, const std::function<void(const QSize&)>& prepare, const PaintFunction& paint);
+
+    /// Time a function, after it has been called once to fill any caches.
+    /// \param name The name to report the results under.
+    /// \param size The size to report the results under.
+    /// \param scale_factor The scale factor to report the results under.
+    /// \param function The function to time.
+    /// \return The measurements.
+    Result Measure(const QString& name, const QSize& size, qreal scale_factor, const std::function<void()>& function) const;
+
+    int               iterations_;          ///< The number of timed paints per size and scale factor.
+    QVector<QSize>    sizes_;               ///< The logical sizes to paint at.
+    QVector<qreal>    scale_factors_;       ///< The scale factors to paint at.
+    AllocationCounter allocation_counter_;  ///< Counts allocations, if set.
+    QVector<Result>   results_;             ///< The results of all runs so far.
+};
+
+#endif  // QTCOMMON_BENCHMARKS_PAINT_BENCHMARK_H_
@@ -7,24 +7,44 @@
 
 #include "arrow_icon_combo_box.h"
 
+#include <algorithm>
+
 #include <QApplication>
 #include <QCheckBox>
+#include <QKeyEvent>
 #include <QPainter>
 
 #include "common_definitions.h"
+#include "paint_profiler.h"
 #include "qt_util.h"
 #include "scaling_manager.h"
 
+#include "arrow_icon_combo_box_model.h"
 #include "scaled_check_box.h"
 #include "scaled_label.h"
+#include "text_search_widget.h"
+#include "virtualized_list_view.h"
 
 const static int kAllIndex       = 0;   ///< The index of the "All" checkbox, if used.
 static const int kTextOffsetX    = 4;   ///< The spacing between the arrow and text, and after the text.
 static const int kButtonBaseSize = 18;  ///< The dimensions of the arrow when viewed at 100% DPI.
 static const int kPenWidth       = 3;   ///< The width of the pen used to draw the arrow.
 
+static const QColor kDefaultFilterColor = QColor(255, 255, 0, 96);  ///< The default color used to highlight the filter text.
+
+static const int kHiddenByCallerRole = Qt::UserRole + 1;  ///< The list widget item role holding whether SetRowHidden() hid the item.
+
 ArrowIconComboBox::ArrowIconComboBox(QWidget* parent)
     : QPushButton(parent)
+    , item_model_(nullptr)
+    , item_delegate_(nullptr)
+    , virtualized_(false)
+    , max_item_width_(-1)
+    , checked_count_(0)
+    , filter_edit_(nullptr)
+    , filter_index_dirty_(true)
+    , filter_pending_(false)
+    , filter_color_(kDefaultFilterColor)
     , allow_multi_select_(false)
     , show_list_above_button_(false)
     , retain_default_text_(false)
@@ -36,6 +56,9 @@ ArrowIconComboBox::ArrowIconComboBox(QWidget* parent)
     , direction_(Direction::DownArrow)
     , pen_width_(kPenWidth)
     , highlight_substring_(false)
+    , text_layout_valid_(false)
+    , text_ascent_(0)
+    , text_cap_height_(0)
 {
     setCursor(Qt::PointingHandCursor);
     setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
@@ -60,12 +83,20 @@ ArrowIconComboBox::~ArrowIconComboBox()
         disconnect(item_list_.get(), &ListWidget::itemClicked, this, &ArrowIconComboBox::ListItemClicked);
     }
 
+    if (item_view_.get() != nullptr)
+    {
+        disconnect(item_view_.get(), &VirtualizedListView::clicked, this, &ArrowIconComboBox::ListIndexClicked);
+        disconnect(item_model_, &ArrowIconComboBoxModel::CheckStateEdited, this, &ArrowIconComboBox::OnItemCheckStateEdited);
+    }
+
     DisconnectSignals();
 }
 
 void ArrowIconComboBox::OnScaleFactorChanged()
 {
     QtCommon::QtUtils::InvalidateFontMetrics(this);
+    InvalidateTextLayout();
+    InvalidateMaxItemWidth();
 
     // Setting a new scaled size will cause the vertices to get recalculated
     // and update the geometry of the widget.
@@ -75,20 +106,77 @@ void ArrowIconComboBox::OnScaleFactorChanged()
     update();
 }
 
+void ArrowIconComboBox::SetVirtualized(bool virtualized)
+{
+    // The list type can't be changed once the list has been created.
+    Q_ASSERT(ItemView() == nullptr);
+
+    if (ItemView() == nullptr)
+    {
+        virtualized_ = virtualized;
+    }
+}
+
 void ArrowIconComboBox::InitItemList(QWidget* main_parent)
 {
-    // Create list widget for the combo box
-    item_list_ = std::unique_ptr<ListWidget>(new ListWidget(main_parent, this, false));
-    item_list_->setObjectName(this->objectName() + "_item_list");
+    QListView* item_view = nullptr;
+
+    if (virtualized_ == true)
+    {
+        // Create a model and view for the combo box. Items are painted by the delegate, so no widgets are created per item.
+        item_model_    = new ArrowIconComboBoxModel(this);
+        item_view_     = std::unique_ptr<VirtualizedListView>(new VirtualizedListView(main_parent, this));
+        item_delegate_ = new ArrowIconComboBoxDelegate(item_view_.get());
+        item_view_->setItemDelegate(item_delegate_);
+        item_view_->setModel(item_model_);
+        item_view = item_view_.get();
+
+        connect(item_model_, &ArrowIconComboBoxModel::CheckStateEdited, this, &ArrowIconComboBox::OnItemCheckStateEdited);
+
+        // Keep the width of the longest item up to date, so the size hint doesn't measure every item.
+        connect(item_model_, &QAbstractItemModel::rowsInserted, this, &ArrowIconComboBox::OnItemRowsInserted);
+        connect(item_model_, &QAbstractItemModel::rowsAboutToBeRemoved, this, &ArrowIconComboBox::OnItemRowsAboutToBeRemoved);
+        connect(item_model_, &QAbstractItemModel::modelReset, this, &ArrowIconComboBox::InvalidateMaxItemWidth);
+    }
+    else
+    {
+        // Create list widget for the combo box
+        item_list_ = std::unique_ptr<ListWidget>(new ListWidget(main_parent, this, false));
+        item_view  = item_list_.get();
+    }
+
+    item_view->setObjectName(this->objectName() + "_item_list");
 
     // Also disable scrollbars on this list widget
-    item_list_->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
-    item_list_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    item_list_->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
-    item_list_->setFont(font());
+    item_view->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    item_view->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    item_view->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+    item_view->setFont(font());
 
     // The item list should not be visible by default.
-    item_list_->hide();
+    item_view->hide();
+}
+
+QListView* ArrowIconComboBox::ItemView() const
+{
+    if (virtualized_ == true)
+    {
+        return item_view_.get();
+    }
+
+    return item_list_.get();
+}
+
+void ArrowIconComboBox::ConnectItemView()
+{
+    if (virtualized_ == true)
+    {
+        connect(item_view_.get(), &VirtualizedListView::clicked, this, &ArrowIconComboBox::ListIndexClicked);
+    }
+    else
+    {
+        connect(item_list_.get(), &ListWidget::itemClicked, this, &ArrowIconComboBox::ListItemClicked);
+    }
 }
 
 void ArrowIconComboBox::InitSingleSelect(QWidget* main_parent, const QString& default_text, bool retain_default_text, const QString& prefix_text)
@@ -104,14 +192,15 @@ void ArrowIconComboBox::InitSingleSelect(QWidget* main_parent, const QString& de
     }
 
     // Start out the combo box with the first entry
-    item_list_->setCurrentRow(0);
-    item_list_->hide();
+    QListView* item_view = ItemView();
+    item_view->setCurrentIndex(item_view->model()->index(0, 0));
+    item_view->hide();
 
     ResetSelection();
 
-    item_list_->setSelectionMode(QAbstractItemView::SelectionMode::SingleSelection);
+    item_view->setSelectionMode(QAbstractItemView::SelectionMode::SingleSelection);
 
-    connect(item_list_.get(), &ListWidget::itemClicked, this, &ArrowIconComboBox::ListItemClicked);
+    ConnectItemView();
 
     qApp->installEventFilter(this);
 }
@@ -130,9 +219,15 @@ void ArrowIconComboBox::InitMultiSelect(QWidget* main_parent, const QString& def
 
     // The multi-select combobox will use checkboxes instead of labels, and the state of those checkboxes
     // will override the selected state of the list items.
-    item_list_->setSelectionMode(QAbstractItemView::SelectionMode::NoSelection);
+    ItemView()->setSelectionMode(QAbstractItemView::SelectionMode::NoSelection);
 
-    connect(item_list_.get(), &ListWidget::itemClicked, this, &ArrowIconComboBox::ListItemClicked);
+    if (virtualized_ == true)
+    {
+        // The delegate paints a checkbox for each item in place of a checkbox widget.
+        item_model_->SetCheckable(true);
+    }
+
+    ConnectItemView();
 
     qApp->installEventFilter(this);
 }
@@ -140,13 +235,20 @@ void ArrowIconComboBox::InitMultiSelect(QWidget* main_parent, const QString& def
 void ArrowIconComboBox::SetListAboveButton(bool list_above_button)
 {
     SetDirection(ArrowIconComboBox::Direction::UpArrow);
-    item_list_->SetListAboveButton(list_above_button);
+    if (virtualized_ == true)
+    {
+        item_view_->SetListAboveButton(list_above_button);
+    }
+    else
+    {
+        item_list_->SetListAboveButton(list_above_button);
+    }
     show_list_above_button_ = list_above_button;
 }
 
 void ArrowIconComboBox::Update()
 {
-    if (item_list_ != nullptr && item_list_->count() == 0)
+    if (ItemView() != nullptr && RowCount() == 0)
     {
         CloseMenu();
 
@@ -162,15 +264,15 @@ void ArrowIconComboBox::ResetSelection()
 int ArrowIconComboBox::PrevRow() const
 {
     // the item list must not be null
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (item_list_ != nullptr)
+    if (ItemView() != nullptr)
     {
-        const int current_row  = item_list_->currentRow();
+        const int current_row  = ItemView()->currentIndex().row();
         const int previous_row = current_row - 1;
         if (previous_row < 0)
         {
-            return item_list_->currentRow();
+            return current_row;
         }
         else
         {
@@ -184,11 +286,11 @@ int ArrowIconComboBox::PrevRow() const
 int ArrowIconComboBox::CurrentRow() const
 {
     // the item list must not be null
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (item_list_ != nullptr)
+    if (ItemView() != nullptr)
     {
-        return item_list_->currentRow();
+        return ItemView()->currentIndex().row();
     }
 
     return -1;
@@ -197,15 +299,15 @@ int ArrowIconComboBox::CurrentRow() const
 int ArrowIconComboBox::NextRow() const
 {
     // the item list must not be null
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (item_list_ != nullptr)
+    if (ItemView() != nullptr)
     {
-        const int current_row = item_list_->currentRow();
+        const int current_row = ItemView()->currentIndex().row();
         const int next_row    = current_row + 1;
-        if (next_row >= item_list_->count())
+        if (next_row >= RowCount())
         {
-            return item_list_->currentRow();
+            return current_row;
         }
         else
         {
@@ -218,7 +320,11 @@ int ArrowIconComboBox::NextRow() const
 
 int ArrowIconComboBox::RowCount() const
 {
-    if (item_list_ != nullptr)
+    if (virtualized_ == true && item_model_ != nullptr)
+    {
+        return item_model_->rowCount();
+    }
+    else if (item_list_ != nullptr)
     {
         return item_list_->count();
     }
@@ -228,12 +334,40 @@ int ArrowIconComboBox::RowCount() const
     }
 }
 
+int ArrowIconComboBox::CheckedCount() const
+{
+    int checked_count = 0;
+    if (virtualized_ == true)
+    {
+        checked_count = (item_model_ != nullptr) ? item_model_->CheckedCount() : 0;
+    }
+    else
+    {
+        checked_count = checked_count_;
+    }
+
+    if (all_choice_added_ == true && IsChecked(kAllIndex) == true)
+    {
+        checked_count--;
+    }
+
+    return checked_count;
+}
+
 void ArrowIconComboBox::SetSelectedRow(int index)
 {
     // the item list must not be null
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (item_list_ != nullptr)
+    if (virtualized_ == true && item_view_ != nullptr)
+    {
+        if (index >= 0 && index < item_model_->rowCount())
+        {
+            item_view_->setCurrentIndex(item_model_->index(index));
+            SetSelectedText(item_model_->Text(index));
+        }
+    }
+    else if (item_list_ != nullptr)
     {
         if (index >= 0 && index < item_list_->count())
         {
@@ -276,28 +410,41 @@ void ArrowIconComboBox::SetSelectedRow(int index)
 
 void ArrowIconComboBox::ClearSelectedRow()
 {
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (item_list_ == nullptr)
+    if (ItemView() == nullptr)
     {
         return;
     }
 
-    item_list_->setCurrentItem(nullptr);
+    ItemView()->setCurrentIndex(QModelIndex());
 }
 
 void ArrowIconComboBox::AllCheckboxClicked(bool checked)
 {
+    if (virtualized_ == true)
+    {
+        item_model_->SetRangeChecked(kAllIndex + 1, item_model_->rowCount() - 1, checked);
+        return;
+    }
+
+    // Change the checkboxes with the list not repainting, so checking "All" costs one repaint rather
+    // than a repaint per checkbox. The checkboxes still emit their signals, since callers may be connected
+    // to them, and OnCheckboxToggled() keeps the checked count in step.
+    item_list_->setUpdatesEnabled(false);
+
     QListWidgetItem* current_item = nullptr;
     for (int i = kAllIndex + 1; i < item_list_->count(); i++)
     {
         current_item        = item_list_->item(i);
         QCheckBox* checkbox = qobject_cast<QCheckBox*>(item_list_->itemWidget(current_item));
-        if (checkbox != nullptr)
+        if (checkbox != nullptr && checkbox->isChecked() != checked)
         {
             checkbox->setChecked(checked);
         }
     }
+
+    item_list_->setUpdatesEnabled(true);
 }
 
 void ArrowIconComboBox::UpdateAllOption(bool recently_checked)
@@ -309,17 +456,16 @@ void ArrowIconComboBox::UpdateAllOption(bool recently_checked)
         if (recently_checked == true)
         {
             // if a checkbox is checked, the "All" checkbox needs checking iff all other checkboxes are checked
-            for (int i = kAllIndex + 1; i < item_list_->count(); i++)
-            {
-                if (IsChecked(i) == false)
-                {
-                    all_items_checked = false;
-                    break;
-                }
-            }
+            all_items_checked = (CheckedCount() == RowCount() - 1);
         }
 
         // set the state of the "All" checkbox
+        if (virtualized_ == true)
+        {
+            item_model_->SetChecked(kAllIndex, all_items_checked);
+            return;
+        }
+
         QListWidgetItem* all_item     = item_list_->item(kAllIndex);
         QCheckBox*       all_checkbox = qobject_cast<QCheckBox*>(item_list_->itemWidget(all_item));
         if (all_checkbox != nullptr)
@@ -341,27 +487,270 @@ void ArrowIconComboBox::OnCheckboxClicked(bool checked)
     {
         emit CheckboxChanged(checkbox);
     }
+
+    emit SelectionChanged();
+}
+
+void ArrowIconComboBox::OnCheckboxToggled(bool checked)
+{
+    checked_count_ += checked ? 1 : -1;
 }
 
 void ArrowIconComboBox::SetRowHidden(int list_index, bool hidden)
 {
-    Q_ASSERT(item_list_ != nullptr);
-    Q_ASSERT(list_index >= 0 && list_index < item_list_->count());
+    Q_ASSERT(ItemView() != nullptr);
+    Q_ASSERT(list_index >= 0 && list_index < RowCount());
 
-    item_list_->setRowHidden(list_index, hidden);
+    // Remember the rows hidden here with their items, separately from the filter, so the filter never shows them.
+    if (virtualized_ == true)
+    {
+        item_model_->SetHidden(list_index, hidden);
+    }
+    else
+    {
+        item_list_->item(list_index)->setData(kHiddenByCallerRole, hidden);
+    }
+
+    bool filter_hidden = false;
+    if (IsFilterEnabled() == true)
+    {
+        // Make sure the filter state is for the current rows.
+        BuildFilterIndex();
+
+        filter_hidden = (std::binary_search(filter_matches_.cbegin(), filter_matches_.cend(), list_index) == false);
+    }
+
+    ItemView()->setRowHidden(list_index, hidden || filter_hidden);
+}
+
+bool ArrowIconComboBox::IsRowHidden(int list_index) const
+{
+    Q_ASSERT(ItemView() != nullptr);
+
+    return ItemView()->isRowHidden(list_index);
+}
+
+bool ArrowIconComboBox::IsRowHiddenByCaller(int list_index) const
+{
+    if (virtualized_ == true)
+    {
+        return item_model_->IsHidden(list_index);
+    }
+
+    return item_list_->item(list_index)->data(kHiddenByCallerRole).toBool();
+}
+
+void ArrowIconComboBox::SetFilterEnabled(bool enabled)
+{
+    Q_ASSERT(ItemView() != nullptr);
+
+    if (ItemView() == nullptr || enabled == IsFilterEnabled())
+    {
+        return;
+    }
+
+    QAbstractItemModel* model = ItemView()->model();
+
+    if (enabled == true)
+    {
+        filter_edit_ = new TextSearchWidget();
+        filter_edit_->setObjectName(this->objectName() + "_filter");
+        filter_edit_->setFont(font());
+        filter_edit_->installEventFilter(this);
+        SetItemViewHeaderWidget(filter_edit_);
+
+        connect(filter_edit_, &TextSearchWidget::textChanged, this, &ArrowIconComboBox::OnFilterTextChanged);
+        connect(model, &QAbstractItemModel::rowsInserted, this, &ArrowIconComboBox::InvalidateFilterIndex);
+        connect(model, &QAbstractItemModel::rowsRemoved, this, &ArrowIconComboBox::InvalidateFilterIndex);
+        connect(model, &QAbstractItemModel::modelReset, this, &ArrowIconComboBox::InvalidateFilterIndex);
+
+        InvalidateFilterIndex();
+    }
+    else
+    {
+        // Show the rows hidden by the filter before removing it.
+        OnFilterTextChanged(QString());
+
+        disconnect(model, &QAbstractItemModel::rowsInserted, this, &ArrowIconComboBox::InvalidateFilterIndex);
+        disconnect(model, &QAbstractItemModel::rowsRemoved, this, &ArrowIconComboBox::InvalidateFilterIndex);
+        disconnect(model, &QAbstractItemModel::modelReset, this, &ArrowIconComboBox::InvalidateFilterIndex);
+
+        SetItemViewHeaderWidget(nullptr);
+        delete filter_edit_;
+        filter_edit_ = nullptr;
+
+        filter_index_.Clear();
+        filter_matches_.clear();
+        filter_index_dirty_ = true;
+    }
+
+    UpdateItemViewSize();
+}
+
+void ArrowIconComboBox::SetFilterText(const QString& filter_text)
+{
+    Q_ASSERT(filter_edit_ != nullptr);
+
+    if (filter_edit_ != nullptr)
+    {
+        filter_edit_->setText(filter_text);
+    }
+}
+
+void ArrowIconComboBox::SetFilterHighlightColor(const QColor& color)
+{
+    filter_color_ = color;
+
+    if (item_delegate_ != nullptr && filter_edit_ != nullptr)
+    {
+        item_delegate_->SetHighlight(filter_edit_->text(), filter_color_);
+        item_view_->viewport()->update();
+    }
+}
+
+void ArrowIconComboBox::InvalidateFilterIndex()
+{
+    filter_index_dirty_ = true;
+
+    // Index the items once the current batch of changes is done, rather than when the user starts typing.
+    if (filter_pending_ == false)
+    {
+        filter_pending_ = true;
+        QMetaObject::invokeMethod(
+            this, [this]() { BuildFilterIndex(); }, Qt::QueuedConnection);
+    }
+}
+
+void ArrowIconComboBox::BuildFilterIndex()
+{
+    QTCOMMON_PROFILE_SCOPE("ArrowIconComboBox::BuildFilterIndex");
+
+    filter_pending_ = false;
+
+    QListView* item_view = ItemView();
+    if (item_view == nullptr || IsFilterEnabled() == false || filter_index_dirty_ == false)
+    {
+        return;
+    }
+
+    const int   row_count = RowCount();
+    QStringList item_texts;
+    item_texts.reserve(row_count);
+    for (int i = 0; i < row_count; i++)
+    {
+        item_texts.append(ItemTextAt(i));
+    }
+
+    filter_index_.Build(item_texts);
+    filter_index_dirty_ = false;
+
+    // Apply the current filter to every row.
+    filter_matches_ = filter_index_.Match(filter_edit_->text());
+
+    item_view->setUpdatesEnabled(false);
+
+    int match_index = 0;
+    for (int i = 0; i < row_count; i++)
+    {
+        const bool matches = (match_index < filter_matches_.size() && filter_matches_[match_index] == i);
+        if (matches == true)
+        {
+            match_index++;
+        }
+
+        const bool hidden = (matches == false || IsRowHiddenByCaller(i) == true);
+        if (item_view->isRowHidden(i) != hidden)
+        {
+            item_view->setRowHidden(i, hidden);
+        }
+    }
+
+    item_view->setUpdatesEnabled(true);
+
+    if (item_view->isVisible() == true)
+    {
+        UpdateItemViewSize();
+    }
+}
+
+void ArrowIconComboBox::ApplyFilterToRow(int list_index, bool filter_hidden)
+{
+    ItemView()->setRowHidden(list_index, filter_hidden || IsRowHiddenByCaller(list_index));
+}
+
+void ArrowIconComboBox::OnFilterTextChanged(const QString& filter_text)
+{
+    QTCOMMON_PROFILE_SCOPE("ArrowIconComboBox::OnFilterTextChanged");
+
+    QListView* item_view = ItemView();
+    if (item_view == nullptr)
+    {
+        return;
+    }
+
+    // The index is normally built as soon as the items change, but the filter may be used before that.
+    BuildFilterIndex();
+
+    const QVector<int>& matches = filter_index_.Match(filter_text);
+
+    // Only show or hide the rows whose state changes. Both lists of rows are in increasing order, so they
+    // can be walked together; while the user types, the new matches are a subset of the previous ones.
+    item_view->setUpdatesEnabled(false);
+
+    int previous_index = 0;
+    int match_index    = 0;
+    while (previous_index < filter_matches_.size() || match_index < matches.size())
+    {
+        if (match_index == matches.size() || (previous_index < filter_matches_.size() && filter_matches_[previous_index] < matches[match_index]))
+        {
+            ApplyFilterToRow(filter_matches_[previous_index], true);
+            previous_index++;
+        }
+        else if (previous_index == filter_matches_.size() || matches[match_index] < filter_matches_[previous_index])
+        {
+            ApplyFilterToRow(matches[match_index], false);
+            match_index++;
+        }
+        else
+        {
+            previous_index++;
+            match_index++;
+        }
+    }
+
+    item_view->setUpdatesEnabled(true);
+
+    filter_matches_ = matches;
+
+    if (item_delegate_ != nullptr)
+    {
+        item_delegate_->SetHighlight(filter_text, filter_color_);
+        item_view->viewport()->update();
+    }
+
+    if (item_view->isVisible() == true)
+    {
+        UpdateItemViewSize();
+    }
 }
 
 void ArrowIconComboBox::SetDisabled(int list_index, bool disabled)
 {
     // Right now this function doesn't support single select items from being disabled since there is not a use case for it.
     Q_ASSERT(allow_multi_select_);
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (!allow_multi_select_ || list_index < 0 || list_index >= item_list_->count())
+    if (!allow_multi_select_ || list_index < 0 || list_index >= RowCount())
     {
         return;
     }
 
+    if (virtualized_ == true)
+    {
+        item_model_->SetDisabled(list_index, disabled);
+        return;
+    }
+
     QListWidgetItem* disable_item          = item_list_->item(list_index);
     QCheckBox*       disable_item_checkbox = qobject_cast<QCheckBox*>(item_list_->itemWidget(disable_item));
     disable_item_checkbox->setDisabled(disabled);
@@ -371,7 +760,7 @@ int ArrowIconComboBox::LastCheckedIndex()
 {
     // Don't allow the last checked index to be called for single select since it doesn't make sense there.
     Q_ASSERT(allow_multi_select_);
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
     // If there is an all button, unchecking everything has to be allowed (by unchecking the all option).
     if (!allow_multi_select_ || all_choice_added_)
@@ -383,16 +772,24 @@ int ArrowIconComboBox::LastCheckedIndex()
     int last_checked_item = -1;
 
     // Loop through all indices to find if there is a last checked item.
-    QListWidgetItem* current_item = nullptr;
-    for (int i = 0; i < item_list_->count(); i++)
+    const int row_count = RowCount();
+    for (int i = 0; i < row_count; i++)
     {
-        current_item             = item_list_->item(i);
-        QCheckBox* item_checkbox = qobject_cast<QCheckBox*>(item_list_->itemWidget(current_item));
+        bool item_enabled = true;
+        if (virtualized_ == true)
+        {
+            item_enabled = !item_model_->IsDisabled(i);
+        }
+        else
+        {
+            QCheckBox* item_checkbox = qobject_cast<QCheckBox*>(item_list_->itemWidget(item_list_->item(i)));
+            item_enabled             = item_checkbox->isEnabled();
+        }
 
         // If there is a disabled item (that is checked), return it's index to be re enabled.
         // If there are other reasons why a checked item may be disabled besides it being the
         // last checked item, this will have unintended results.
-        if (!item_checkbox->isEnabled() && IsChecked(i))
+        if (!item_enabled && IsChecked(i))
         {
             return i;
         }
@@ -423,9 +820,9 @@ int ArrowIconComboBox::LastCheckedIndex()
 
 void ArrowIconComboBox::SetMaximumHeight(int height)
 {
-    if (item_list_ != nullptr)
+    if (ItemView() != nullptr)
     {
-        item_list_->setMaximumHeight(height);
+        ItemView()->setMaximumHeight(height);
     }
 }
 
@@ -433,9 +830,9 @@ void ArrowIconComboBox::SetFixedWidth(int width)
 {
     setFixedWidth(width);
 
-    if (item_list_ != nullptr)
+    if (ItemView() != nullptr)
     {
-        item_list_->setFixedWidth(width);
+        ItemView()->setFixedWidth(width);
     }
 }
 
@@ -443,7 +840,12 @@ void ArrowIconComboBox::ClearItems()
 {
     all_choice_added_    = false;
     all_choice_selected_ = false;
-    if (item_list_ != nullptr)
+    checked_count_       = 0;
+    if (item_model_ != nullptr)
+    {
+        item_model_->Clear();
+    }
+    else if (item_list_ != nullptr)
     {
         item_list_->clear();
     }
@@ -451,8 +853,15 @@ void ArrowIconComboBox::ClearItems()
 
 void ArrowIconComboBox::AddItem(QListWidgetItem* item)
 {
-    Q_ASSERT(item_list_ != nullptr);
-    if (item_list_ != nullptr)
+    Q_ASSERT(ItemView() != nullptr);
+    if (virtualized_ == true && item_model_ != nullptr)
+    {
+        // A virtualized list keeps only the text and user data of the item.
+        Q_ASSERT(!allow_multi_select_);
+        item_model_->InsertItem(-1, item->text(), item->data(Qt::UserRole), false);
+        delete item;
+    }
+    else if (item_list_ != nullptr)
     {
         Q_ASSERT(!allow_multi_select_);
         item_list_->addItem(item);
@@ -461,8 +870,8 @@ void ArrowIconComboBox::AddItem(QListWidgetItem* item)
 
 void ArrowIconComboBox::AddItem(const QString& item_text, const QVariant& user_data)
 {
-    Q_ASSERT(item_list_ != nullptr);
-    if (item_list_ != nullptr)
+    Q_ASSERT(ItemView() != nullptr);
+    if (ItemView() != nullptr)
     {
         if (allow_multi_select_)
         {
@@ -485,6 +894,12 @@ QLabel* ArrowIconComboBox::AddLabelItem(const QString& item_text, const QVariant
         return nullptr;
     }
 
+    if (virtualized_ == true)
+    {
+        item_model_->InsertItem(-1, item_text, user_data, false);
+        return nullptr;
+    }
+
     QListWidgetItem* item = new QListWidgetItem();
     item->setFont(item_list_->font());
 
@@ -513,6 +928,27 @@ QCheckBox* ArrowIconComboBox::AddCheckboxItem(const QString& item_text, const QV
         return nullptr;
     }
 
+    if (virtualized_ == true)
+    {
+        if (is_all_option)
+        {
+            // An "All" checkbox can only be added once. Assert this has not already been added.
+            Q_ASSERT(all_choice_added_ == false);
+            if (all_choice_added_ == false)
+            {
+                all_choice_added_ = true;
+                item_model_->InsertItem(kAllIndex, item_text, user_data, checked);
+            }
+        }
+        else
+        {
+            item_model_->InsertItem(-1, item_text, user_data, checked);
+            UpdateAllOption(checked);
+        }
+
+        return nullptr;
+    }
+
     QListWidgetItem* item = new QListWidgetItem();
     item->setFont(item_list_->font());
 
@@ -538,6 +974,11 @@ QCheckBox* ArrowIconComboBox::AddCheckboxItem(const QString& item_text, const QV
             item_list_->insertItem(kAllIndex, item);
             item_list_->setItemWidget(item, checkbox);
             checkbox->setObjectName("checkbox_option_all");
+
+            if (checked == true)
+            {
+                checked_count_++;
+            }
         }
     }
     else
@@ -546,6 +987,11 @@ QCheckBox* ArrowIconComboBox::AddCheckboxItem(const QString& item_text, const QV
         item_list_->setItemWidget(item, checkbox);
         checkbox->setObjectName("checkbox_option_" + QString::number(item_list_->count()));
 
+        if (checked == true)
+        {
+            checked_count_++;
+        }
+
         UpdateAllOption(checked);
     }
 
@@ -558,11 +1004,49 @@ QCheckBox* ArrowIconComboBox::AddCheckboxItem(const QString& item_text, const QV
     // Connect to clicked signal so that the "All" checkbox can be updated if needed.
     connect(checkbox, &QCheckBox::clicked, this, &ArrowIconComboBox::OnCheckboxClicked);
 
+    // Connect to toggled signal to count the checked checkboxes, however their state is changed.
+    connect(checkbox, &QCheckBox::toggled, this, &ArrowIconComboBox::OnCheckboxToggled);
+
     return checkbox;
 }
 
+void ArrowIconComboBox::AddItems(const QStringList& item_texts, bool checked)
+{
+    Q_ASSERT(ItemView() != nullptr);
+
+    if (virtualized_ == true && item_model_ != nullptr)
+    {
+        item_model_->AddItems(item_texts, checked);
+
+        if (allow_multi_select_)
+        {
+            UpdateAllOption(checked);
+        }
+    }
+    else if (item_list_ != nullptr)
+    {
+        for (const QString& item_text : item_texts)
+        {
+            if (allow_multi_select_)
+            {
+                AddCheckboxItem(item_text, QVariant(), checked, false);
+            }
+            else
+            {
+                AddLabelItem(item_text, QVariant());
+            }
+        }
+    }
+}
+
 const QListWidgetItem* ArrowIconComboBox::FindItem(const QWidget* widget) const
 {
+    // A virtualized list has no item widgets.
+    if (item_list_ == nullptr)
+    {
+        return nullptr;
+    }
+
     QListWidgetItem* current_item = nullptr;
     for (int i = 0; i < item_list_->count(); i++)
     {
@@ -577,14 +1061,25 @@ const QListWidgetItem* ArrowIconComboBox::FindItem(const QWidget* widget) const
 
 QListWidgetItem* ArrowIconComboBox::FindItem(const int list_index) const
 {
-    Q_ASSERT(item_list_ != nullptr);
-    Q_ASSERT(list_index >= 0 && list_index < item_list_->count());
+    Q_ASSERT(ItemView() != nullptr);
+    Q_ASSERT(list_index >= 0 && list_index < RowCount());
+
+    // A virtualized list has no list widget items.
+    if (item_list_ == nullptr)
+    {
+        return nullptr;
+    }
 
     return item_list_->item(list_index);
 }
 
 bool ArrowIconComboBox::IsChecked(int list_index) const
 {
+    if (virtualized_ == true)
+    {
+        return item_model_->IsChecked(list_index);
+    }
+
     QListWidgetItem* item = item_list_->item(list_index);
     Q_ASSERT(item);
 
@@ -598,6 +1093,16 @@ bool ArrowIconComboBox::IsChecked(int list_index) const
 
 bool ArrowIconComboBox::SetChecked(int list_index, bool checked)
 {
+    if (virtualized_ == true)
+    {
+        if (allow_multi_select_ && list_index >= 0 && list_index < item_model_->rowCount())
+        {
+            item_model_->SetChecked(list_index, checked);
+            return true;
+        }
+        return false;
+    }
+
     QListWidgetItem* item = item_list_->item(list_index);
     if (item != nullptr)
     {
@@ -613,9 +1118,13 @@ bool ArrowIconComboBox::SetChecked(int list_index, bool checked)
 
 QVariant ArrowIconComboBox::ItemData(int index, int role) const
 {
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (item_list_ != nullptr)
+    if (virtualized_ == true && item_model_ != nullptr)
+    {
+        return item_model_->index(index).data(role);
+    }
+    else if (item_list_ != nullptr)
     {
         if (index < item_list_->count() && index >= 0)
         {
@@ -628,13 +1137,32 @@ QVariant ArrowIconComboBox::ItemData(int index, int role) const
 
 void ArrowIconComboBox::RemoveItem(const QString& item_string)
 {
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (item_list_ == nullptr || item_list_->count() == 0)
+    if (RowCount() == 0)
     {
         return;
     }
 
+    if (virtualized_ == true)
+    {
+        for (int i = item_model_->rowCount() - 1; i >= 0; i--)
+        {
+            if (item_model_->Text(i) == item_string)
+            {
+                // if removing the "All" item, remove the "All" functionality from the combo box
+                if (all_choice_added_ == true && i == kAllIndex)
+                {
+                    all_choice_added_    = false;
+                    all_choice_selected_ = false;
+                }
+
+                item_model_->RemoveItem(i);
+            }
+        }
+        return;
+    }
+
     for (int i = item_list_->count() - 1; i >= 0; i--)
     {
         QListWidgetItem* item = item_list_->item(i);
@@ -652,6 +1180,11 @@ void ArrowIconComboBox::RemoveItem(const QString& item_string)
                 all_choice_selected_ = false;
             }
 
+            if (check_box_widget != nullptr && check_box_widget->isChecked() == true)
+            {
+                checked_count_--;
+            }
+
             item = item_list_->takeItem(i);
             delete item;
         }
@@ -660,13 +1193,25 @@ void ArrowIconComboBox::RemoveItem(const QString& item_string)
 
 void ArrowIconComboBox::RemoveItem(const int item_index)
 {
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (item_list_ == nullptr || item_index >= item_list_->count() || item_index < 0)
+    if (item_index >= RowCount() || item_index < 0)
     {
         return;
     }
 
+    if (virtualized_ == true)
+    {
+        if (all_choice_added_ == true && item_index == kAllIndex)
+        {
+            all_choice_added_    = false;
+            all_choice_selected_ = false;
+        }
+
+        item_model_->RemoveItem(item_index);
+        return;
+    }
+
     if (all_choice_added_ == true && item_index == kAllIndex)
     {
         DisconnectSignals();
@@ -674,12 +1219,25 @@ void ArrowIconComboBox::RemoveItem(const int item_index)
         all_choice_selected_ = false;
     }
 
+    const QCheckBox* checkbox = qobject_cast<QCheckBox*>(item_list_->itemWidget(item_list_->item(item_index)));
+    if (checkbox != nullptr && checkbox->isChecked() == true)
+    {
+        checked_count_--;
+    }
+
     QListWidgetItem* item = item_list_->takeItem(item_index);
     delete item;
 }
 
 void ArrowIconComboBox::SetAnchor(QPoint point)
 {
+    if (virtualized_ == true)
+    {
+        const QSize size_hint = item_view_->sizeHint();
+        item_view_->setGeometry(point.x(), point.y(), size_hint.width(), size_hint.height());
+        return;
+    }
+
     int height = item_list_->GetListWidgetHeight();
     int width  = item_list_->GetListWidgetWidth();
     item_list_->setGeometry(point.x(), point.y(), width, height);
@@ -707,11 +1265,35 @@ void ArrowIconComboBox::DisconnectSignals()
     }
 }
 
+void ArrowIconComboBox::UpdateItemViewSize()
+{
+    if (item_view_ != nullptr)
+    {
+        item_view_->UpdateSize();
+    }
+    else if (item_list_ != nullptr)
+    {
+        item_list_->UpdateSize();
+    }
+}
+
+void ArrowIconComboBox::SetItemViewHeaderWidget(QWidget* header_widget)
+{
+    if (item_view_ != nullptr)
+    {
+        item_view_->SetHeaderWidget(header_widget);
+    }
+    else if (item_list_ != nullptr)
+    {
+        item_list_->SetHeaderWidget(header_widget);
+    }
+}
+
 void ArrowIconComboBox::OpenMenu()
 {
-    Q_ASSERT(item_list_ != nullptr);
+    Q_ASSERT(ItemView() != nullptr);
 
-    if (item_list_->count() > 0)
+    if (RowCount() > 0)
     {
         if (true == show_list_above_button_)
         {
@@ -722,8 +1304,19 @@ void ArrowIconComboBox::OpenMenu()
             SetDirection(ArrowIconComboBox::Direction::UpArrow);
         }
 
-        item_list_->UpdateSize();
-        item_list_->show();
+        // Start each time with an empty filter, so every item is shown.
+        if (filter_edit_ != nullptr)
+        {
+            filter_edit_->clear();
+        }
+
+        UpdateItemViewSize();
+        ItemView()->show();
+
+        if (filter_edit_ != nullptr)
+        {
+            filter_edit_->setFocus();
+        }
 
         emit Opened();
     }
@@ -740,9 +1333,9 @@ void ArrowIconComboBox::CloseMenu()
         SetDirection(ArrowIconComboBox::Direction::DownArrow);
     }
 
-    if (item_list_ != nullptr)
+    if (ItemView() != nullptr)
     {
-        item_list_->hide();
+        ItemView()->hide();
 
         emit Closed();
     }
@@ -750,15 +1343,30 @@ void ArrowIconComboBox::CloseMenu()
 
 bool ArrowIconComboBox::eventFilter(QObject* object, QEvent* event)
 {
-    Q_UNUSED(object);
-
     if (event != nullptr)
     {
+        if (object == filter_edit_ && event->type() == QEvent::KeyPress)
+        {
+            const int key = static_cast<QKeyEvent*>(event)->key();
+
+            // Escape closes the list, and the down arrow moves from the filter field into the items.
+            if (key == Qt::Key_Escape)
+            {
+                CloseMenu();
+                return true;
+            }
+            else if (key == Qt::Key_Down)
+            {
+                ItemView()->setFocus();
+                return true;
+            }
+        }
+
         if (event->type() == QEvent::MouseButtonPress)
         {
-            if (item_list_ != nullptr)
+            if (ItemView() != nullptr)
             {
-                if ((this->underMouse() == false) && (item_list_->underMouse() == false))
+                if ((this->underMouse() == false) && (ItemView()->underMouse() == false))
                 {
                     CloseMenu();
                 }
@@ -786,20 +1394,11 @@ QSize ArrowIconComboBox::sizeHint() const
         // Width is arrow size + offset + current text size + offset.
         size_hint.setWidth(size_ + total_scaled_text_offsets + fontMetrics().horizontalAdvance(text()));
     }
-    else if (item_list_ != nullptr)
+    else if (ItemView() != nullptr)
     {
-        // Find the longest item in the list.
-        QListWidgetItem* current_item   = nullptr;
-        int              max_item_width = 0;
-        for (int i = 0; i < item_list_->count(); i++)
-        {
-            current_item   = item_list_->item(i);
-            int item_width = fontMetrics().horizontalAdvance(ItemText(current_item));
-            if (item_width > max_item_width)
-            {
-                max_item_width = item_width;
-            }
-        }
+        // Find the longest item in the list. A virtualized list keeps this up to date as items are added
+        // and removed, so only the first size hint measures every item.
+        const int max_item_width = (virtualized_ == true) ? MaxItemWidth() : MeasureItemWidths(0, RowCount() - 1);
 
         int prefix_width = fontMetrics().horizontalAdvance(prefix_text_);
 
@@ -831,18 +1430,56 @@ void ArrowIconComboBox::ListItemClicked(QListWidgetItem* item)
 
                 // Emit selected item signal
                 emit SelectedItem(item);
+                emit SelectedIndex(item_list_->row(item));
             }
         }
     }
 }
 
+void ArrowIconComboBox::ListIndexClicked(const QModelIndex& index)
+{
+    if (index.isValid() == false)
+    {
+        return;
+    }
+
+    const Qt::ItemFlags item_flags = item_model_->flags(index);
+
+    // Don't set the selected text if this item has a checkbox; the delegate toggles it.
+    if (item_flags.testFlag(Qt::ItemIsEnabled) == true && item_flags.testFlag(Qt::ItemIsUserCheckable) == false)
+    {
+        SetSelectedText(item_model_->Text(index.row()));
+
+        if (allow_multi_select_ == false)
+        {
+            CloseMenu();
+        }
+
+        emit SelectedIndex(index.row());
+    }
+}
+
+void ArrowIconComboBox::OnItemCheckStateEdited(int list_index, bool checked)
+{
+    if (all_choice_added_ == true && list_index == kAllIndex)
+    {
+        AllCheckboxClicked(checked);
+    }
+
+    UpdateAllOption(checked);
+
+    emit CheckboxStateChanged(checked);
+    emit ItemCheckStateChanged(list_index, checked);
+    emit SelectionChanged();
+}
+
 void ArrowIconComboBox::mousePressEvent(QMouseEvent* event)
 {
     QPushButton::mousePressEvent(event);
 
-    if (item_list_ != nullptr)
+    if (ItemView() != nullptr)
     {
-        if (item_list_->isVisible())
+        if (ItemView()->isVisible())
         {
             CloseMenu();
         }
@@ -866,6 +1503,86 @@ void ArrowIconComboBox::SetSelectedText(const QString& selection)
     emit SelectionChanged();
 }
 
+int ArrowIconComboBox::MaxItemWidth() const
+{
+    Q_ASSERT(virtualized_ == true);
+
+    if (max_item_width_ < 0)
+    {
+        max_item_width_ = MeasureItemWidths(0, RowCount() - 1);
+    }
+
+    return max_item_width_;
+}
+
+int ArrowIconComboBox::ShownRowCount() const
+{
+    Q_ASSERT(virtualized_ == true);
+
+    if (IsFilterEnabled() == true && filter_index_dirty_ == false)
+    {
+        int shown_row_count = 0;
+        for (int row : filter_matches_)
+        {
+            if (item_model_->IsHidden(row) == false)
+            {
+                shown_row_count++;
+            }
+        }
+
+        return shown_row_count;
+    }
+
+    return item_model_->rowCount() - item_model_->HiddenCount();
+}
+
+int ArrowIconComboBox::MeasureItemWidths(int first_row, int last_row) const
+{
+    const QFontMetrics font_metrics   = fontMetrics();
+    int                max_item_width = 0;
+    for (int i = first_row; i <= last_row; i++)
+    {
+        max_item_width = std::max(max_item_width, font_metrics.horizontalAdvance(ItemTextAt(i)));
+    }
+
+    return max_item_width;
+}
+
+void ArrowIconComboBox::OnItemRowsInserted(const QModelIndex& parent, int first, int last)
+{
+    Q_UNUSED(parent);
+
+    if (max_item_width_ >= 0)
+    {
+        max_item_width_ = std::max(max_item_width_, MeasureItemWidths(first, last));
+    }
+}
+
+void ArrowIconComboBox::OnItemRowsAboutToBeRemoved(const QModelIndex& parent, int first, int last)
+{
+    Q_UNUSED(parent);
+
+    if (max_item_width_ >= 0 && MeasureItemWidths(first, last) >= max_item_width_)
+    {
+        InvalidateMaxItemWidth();
+    }
+}
+
+void ArrowIconComboBox::InvalidateMaxItemWidth()
+{
+    max_item_width_ = -1;
+}
+
+QString ArrowIconComboBox::ItemTextAt(int list_index) const
+{
+    if (virtualized_ == true)
+    {
+        return item_model_->Text(list_index);
+    }
+
+    return ItemText(item_list_->item(list_index));
+}
+
 QString ArrowIconComboBox::ItemText(QListWidgetItem* list_item) const
 {
     QString  item_text   = list_item->text();
@@ -896,6 +1613,8 @@ QString ArrowIconComboBox::ItemText(QListWidgetItem* list_item) const
 
 void ArrowIconComboBox::paintEvent(QPaintEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("ArrowIconComboBox::paintEvent");
+
     Q_UNUSED(event);
 
     const int scaled_text_offset_x = kTextOffsetX;
@@ -967,32 +1686,35 @@ void ArrowIconComboBox::paintEvent(QPaintEvent* event)
     }
     painter.setPen(pen);
 
+    // setText() isn't virtual, so a text change is found by comparing with the laid out text.
+    if (text_layout_valid_ == false || layout_text_ != text())
+    {
+        UpdateTextLayout();
+    }
+
+    const int text_base_x = size_ + scaled_text_offset_x;
+
     // Highlight substring if it is requested.
     if (highlight_substring_)
     {
         // Go through all highlight locations.
-        for (const auto& string_highlight_data : string_highlight_data_)
+        for (int i = 0; i < highlight_rects_.size(); i++)
         {
-            QString current            = text().mid(0, string_highlight_data.start_location + 1);
-            int     initial_text_width = painter.fontMetrics().horizontalAdvance(current);
-
-            current = text().mid(string_highlight_data.start_location, string_highlight_data.end_location - string_highlight_data.start_location);
-            if (!current.isNull())
+            const QRect& highlight_rect = highlight_rects_[i];
+            if (highlight_rect.isValid() == true)
             {
-                int   width = painter.fontMetrics().boundingRect(current).width();
-                QRect rect  = this->rect();
-                rect.setX(rect.x() + size_ + scaled_text_offset_x + initial_text_width);
-                rect.setWidth(width);
-                painter.fillRect(rect, string_highlight_data.highlight_color);
+                QRect rect = this->rect();
+                rect.setX(rect.x() + text_base_x + highlight_rect.x());
+                rect.setWidth(highlight_rect.width());
+                painter.fillRect(rect, string_highlight_data_[i].highlight_color);
             }
         }
     }
 
-    // Draw the text.
-    int half_font_height = painter.fontMetrics().capHeight() / 2;
+    // Draw the text. The static text is positioned by its top, so go up from the baseline by the ascent.
+    int half_font_height = text_cap_height_ / 2;
     int text_base_y      = half_height + half_font_height;
-    int text_base_x      = size_ + scaled_text_offset_x;
-    painter.drawText(text_base_x, text_base_y, text());
+    painter.drawStaticText(text_base_x, text_base_y - text_ascent_, static_text_);
 
     // Draw the borders of the widget on focus or mouse hover,
     // if it is requested.
@@ -1073,6 +1795,7 @@ void ArrowIconComboBox::SetHighLightSubString(bool value)
 void ArrowIconComboBox::SetHighLightSubStringData(QVector<StringHighlightData> string_highlight_data)
 {
     string_highlight_data_ = string_highlight_data;
+    InvalidateTextLayout();
 }
 
 void ArrowIconComboBox::RemoveEventFilter()
@@ -1096,6 +1819,46 @@ void ArrowIconComboBox::ClearHighLightSubStringData()
 {
     string_highlight_data_.clear();
     string_highlight_data_.squeeze();
+    InvalidateTextLayout();
+}
+
+void ArrowIconComboBox::InvalidateTextLayout()
+{
+    text_layout_valid_ = false;
+}
+
+void ArrowIconComboBox::UpdateTextLayout()
+{
+    const QFontMetrics font_metrics = fontMetrics();
+
+    layout_text_ = text();
+    static_text_.setText(layout_text_);
+    static_text_.setTextFormat(Qt::PlainText);
+    static_text_.prepare(QTransform(), font());
+
+    text_ascent_     = font_metrics.ascent();
+    text_cap_height_ = font_metrics.capHeight();
+
+    // Measure each highlight once. An invalid rectangle marks a highlight outside the text.
+    highlight_rects_.clear();
+    highlight_rects_.reserve(string_highlight_data_.size());
+    for (const auto& string_highlight_data : string_highlight_data_)
+    {
+        QRect highlight_rect;
+
+        QString current            = layout_text_.mid(0, string_highlight_data.start_location + 1);
+        int     initial_text_width = font_metrics.horizontalAdvance(current);
+
+        current = layout_text_.mid(string_highlight_data.start_location, string_highlight_data.end_location - string_highlight_data.start_location);
+        if (!current.isNull())
+        {
+            highlight_rect = QRect(initial_text_width, 0, font_metrics.boundingRect(current).width(), 1);
+        }
+
+        highlight_rects_.append(highlight_rect);
+    }
+
+    text_layout_valid_ = true;
 }
 
 void ArrowIconComboBox::CreateVertices()
@@ -1135,6 +1898,17 @@ void ArrowIconComboBox::focusOutEvent(QFocusEvent* event)
     QPushButton::focusOutEvent(event);
 }
 
+void ArrowIconComboBox::changeEvent(QEvent* event)
+{
+    if (event->type() == QEvent::FontChange)
+    {
+        InvalidateTextLayout();
+        InvalidateMaxItemWidth();
+    }
+
+    QPushButton::changeEvent(event);
+}
+
 void ArrowIconComboBox::showEvent(QShowEvent* show_event)
 {
     QPushButton::showEvent(show_event);
@@ -14,8 +14,16 @@
 #include <QLabel>
 #include <QListWidgetItem>
 #include <QPushButton>
+#include <QStaticText>
 
 #include "qt_common/custom_widgets/list_widget.h"
+#include "qt_common/utils/text_filter_index.h"
+
+class ArrowIconComboBoxDelegate;
+class ArrowIconComboBoxModel;
+class QListView;
+class TextSearchWidget;
+class VirtualizedListView;
 
 /// struct for highlight data
 struct StringHighlightData
@@ -42,6 +50,7 @@ class ArrowIconComboBox : public QPushButton
     Q_PROPERTY(int currentItem READ CurrentRow WRITE SetSelectedRow)
 
     friend class ListWidget;
+    friend class VirtualizedListView;
 
 public:
     /// Constructor for ArrowIconComboBox.
@@ -74,6 +83,23 @@ public:
     /// \param default_text The default text to display in the widget before an item is selected.
     void InitMultiSelect(QWidget* main_parent, const QString& default_text);
 
+    /// Set whether the list keeps its items in a model, rather than in a list widget with a widget per item.
+    ///
+    /// A virtualized list paints its items and checkboxes with a delegate and keeps the checked states in
+    /// a bit vector, so lists with thousands of items open and clear quickly. Must be called before
+    /// InitSingleSelect() or InitMultiSelect(). No QListWidgetItem or QCheckBox objects exist for the
+    /// items of a virtualized list: AddCheckboxItem() and FindItem() return nullptr, and SelectedItem and
+    /// CheckboxChanged are not emitted; use SelectedIndex and ItemCheckStateChanged instead.
+    /// \param virtualized true to use a virtualized list, false to use a list widget (default).
+    void SetVirtualized(bool virtualized);
+
+    /// Check whether the list is virtualized.
+    /// \return true if the items are kept in a model, false if they are kept in a list widget.
+    bool IsVirtualized() const
+    {
+        return virtualized_;
+    }
+
     /// Set whether the list box should go above the button (for list boxes at the bottom of the screen).
     /// \param list_above_button If true, draw the list box above the button. Otherwise draw if below (default).
     void SetListAboveButton(bool list_above_button);
@@ -97,6 +123,11 @@ public:
     /// \return nullptr if this is a single-select combobox; otherwise the checkbox created.
     QCheckBox* AddCheckboxItem(const QString& item_text, const QVariant& user_data, bool checked, bool is_all_option);
 
+    /// Add several items at once. For a virtualized list, this is a single model update.
+    /// \param item_texts The strings to be added to the list.
+    /// \param checked The initial checked state of the items, for multi-select comboboxes.
+    void AddItems(const QStringList& item_texts, bool checked = true);
+
     /// Clear the list of all items.
     void ClearItems();
 
@@ -135,10 +166,45 @@ public:
     bool SetChecked(int list_index, bool checked);
 
     /// Show/Hide an individual row in the list.
+    /// A hidden row stays hidden whatever the filter shows, and a shown row is only visible while it matches the filter.
+    /// The hidden state is kept with the item, so it follows the item as other rows are inserted or removed.
     /// \param list_index The index of the row.
     /// \param hidden     The state of the row.
     void SetRowHidden(int list_index, bool hidden);
 
+    /// Check whether a row is hidden, either with SetRowHidden() or by the filter.
+    /// \param list_index The index of the row.
+    /// \return true if the row is hidden, false otherwise.
+    bool IsRowHidden(int list_index) const;
+
+    /// Add a filter field to the top of the list, or remove it.
+    ///
+    /// As the user types in the filter field, items that don't contain the filter text (ignoring case)
+    /// are hidden. In a virtualized list, the item delegate also highlights the first match in each item;
+    /// list widget items paint themselves, so they are filtered but not highlighted. This is separate from
+    /// SetHighLightSubStringData(), which highlights the button text. The filter only hides rows,
+    /// so rows hidden with SetRowHidden() stay hidden. The item texts are indexed once after each batch
+    /// of item changes, rather than when the user starts typing, and each keystroke only shows or hides
+    /// the rows whose state changes. The filter is cleared each time the list opens. Must be called after
+    /// InitSingleSelect() or InitMultiSelect().
+    /// \param enabled true to add the filter field, false to remove it.
+    void SetFilterEnabled(bool enabled);
+
+    /// Check whether the list has a filter field.
+    /// \return true if the list has a filter field, false otherwise.
+    bool IsFilterEnabled() const
+    {
+        return filter_edit_ != nullptr;
+    }
+
+    /// Set the text of the filter field, filtering the list as if the user had typed it.
+    /// \param filter_text The filter text.
+    void SetFilterText(const QString& filter_text);
+
+    /// Set the color used to highlight the filter text in the items of a virtualized list.
+    /// \param color The highlight color.
+    void SetFilterHighlightColor(const QColor& color);
+
     /// @Brief Disables/enables the item at the given index. If the index is invalid, does nothing.
     ///
     /// @param list_index The index of the item to be disabled/enabled.
@@ -181,6 +247,11 @@ public:
     /// \return item list row count
     int RowCount() const;
 
+    /// Get the number of checked items in a multi-select combobox, not counting the "All" option.
+    /// The count is kept up to date as items change, so this doesn't visit the items.
+    /// \return The number of checked items.
+    int CheckedCount() const;
+
     /// Set current row
     /// \param index the list index to select
     void SetSelectedRow(int index);
@@ -284,12 +355,18 @@ signals:
     void FocusOutEvent();
 
     /// Emitted when the list selection changes.
+    /// For multi-select comboboxes, this is emitted once each time the user checks or unchecks an item,
+    /// including when checking or unchecking the "All" option changes every item.
     void SelectionChanged();
 
     /// Emitted when an item is selected
     /// \param item The item that has been selected
     void SelectedItem(QListWidgetItem* item);
 
+    /// Emitted when an item is selected.
+    /// \param list_index The index of the item that has been selected.
+    void SelectedIndex(int list_index);
+
     /// Emitted when the checked state of an item has changed.
     /// If you need to know which checkbox has changed, use CheckboxChanged instead.
     /// \param checkstate The new checked state of the item.
@@ -299,6 +376,11 @@ signals:
     /// \param checkbox The checkbox that has been changed.
     void CheckboxChanged(QCheckBox* checkbox);
 
+    /// Emitted when the user changes the checked state of an item in a virtualized list.
+    /// \param list_index The index of the item.
+    /// \param checked The new checked state of the item.
+    void ItemCheckStateChanged(int list_index, bool checked);
+
 protected:
     /// Sets an anchor point for item list
     ///
@@ -342,6 +424,10 @@ protected:
     /// \param show_event The QShowEvent.
     void showEvent(QShowEvent* show_event) Q_DECL_OVERRIDE;
 
+    /// Override the change event to lay the text out again when the font changes.
+    /// \param event The QEvent.
+    void changeEvent(QEvent* event) Q_DECL_OVERRIDE;
+
 private slots:
     /// Handle what happens when a list item is clicked
     /// \param item The clicked item
@@ -357,6 +443,45 @@ private slots:
     /// \param checked The state of the checkbox selected
     void OnCheckboxClicked(bool checked);
 
+    /// Keep the count of checked checkboxes up to date when a checkbox changes state.
+    /// \param checked The new state of the checkbox.
+    void OnCheckboxToggled(bool checked);
+
+    /// Handle what happens when an item of a virtualized list is clicked.
+    /// \param index The model index of the clicked item.
+    void ListIndexClicked(const QModelIndex& index);
+
+    /// Handle what happens when the user checks or unchecks an item of a virtualized list.
+    /// \param list_index The index of the item.
+    /// \param checked The new checked state of the item.
+    void OnItemCheckStateEdited(int list_index, bool checked);
+
+    /// Show the items containing the filter text, and hide the others.
+    /// \param filter_text The filter text.
+    void OnFilterTextChanged(const QString& filter_text);
+
+    /// Mark the filter index out of date, after items are added or removed, and index the items again
+    /// once control returns to the event loop.
+    void InvalidateFilterIndex();
+
+    /// Index the item texts for the filter if they have changed, and apply the filter to every row.
+    void BuildFilterIndex();
+
+    /// Include items added to the virtualized list in the width of its longest item.
+    /// \param parent The parent of the items, which is always the root.
+    /// \param first The first added row.
+    /// \param last The last added row.
+    void OnItemRowsInserted(const QModelIndex& parent, int first, int last);
+
+    /// Mark the width of the longest item of the virtualized list out of date if that item is being removed.
+    /// \param parent The parent of the items, which is always the root.
+    /// \param first The first row being removed.
+    /// \param last The last row being removed.
+    void OnItemRowsAboutToBeRemoved(const QModelIndex& parent, int first, int last);
+
+    /// Mark the width of the longest item of the virtualized list out of date.
+    void InvalidateMaxItemWidth();
+
     /// Updates font size and arrow size on DPI scale changes.
     void OnScaleFactorChanged();
 
@@ -372,6 +497,52 @@ private:
     /// \param main_parent The main pane that this combobox is on (since the item list needs to appear on-top of the pane).
     void InitItemList(QWidget* main_parent);
 
+    /// Connect the item click signal of the list widget or the virtualized list.
+    void ConnectItemView();
+
+    /// Get the view showing the items, whether it is a list widget or a virtualized list.
+    /// \return The view, or nullptr if the combobox isn't initialized.
+    QListView* ItemView() const;
+
+    /// Retrieve the text string for the item at an index.
+    /// \param list_index The index of the item.
+    /// \return The text string for the item.
+    QString ItemTextAt(int list_index) const;
+
+    /// Get the width of the longest item text of a virtualized list. It is measured once, then kept
+    /// up to date as items are added and removed.
+    /// \return The width, in pixels.
+    int MaxItemWidth() const;
+
+    /// Get the number of rows a virtualized list shows, without checking each row. With a filter,
+    /// only the rows matching it are checked. While the filter index is out of date, rows that the
+    /// filter will hide once it is built are included.
+    /// \return The number of shown rows.
+    int ShownRowCount() const;
+
+    /// Measure the width of the longest text of a range of items.
+    /// \param first_row The first item to measure.
+    /// \param last_row The last item to measure.
+    /// \return The width, in pixels, or 0 if the range is empty.
+    int MeasureItemWidths(int first_row, int last_row) const;
+
+    /// Check whether a row was hidden with SetRowHidden().
+    /// \param list_index The index of the row.
+    /// \return true if the row was hidden by the caller, false otherwise.
+    bool IsRowHiddenByCaller(int list_index) const;
+
+    /// Show or hide a row for the filter, keeping it hidden if it was hidden with SetRowHidden().
+    /// \param list_index The index of the row.
+    /// \param filter_hidden Whether the filter hides the row.
+    void ApplyFilterToRow(int list_index, bool filter_hidden);
+
+    /// Update the size of the list widget or virtualized list to fit the items that are shown.
+    void UpdateItemViewSize();
+
+    /// Set the widget shown above the items of the list widget or virtualized list.
+    /// \param header_widget The widget, or nullptr for none.
+    void SetItemViewHeaderWidget(QWidget* header_widget);
+
     /// Open the list
     void OpenMenu();
 
@@ -387,6 +558,12 @@ private:
     /// Create the vertices for the arrow.
     void CreateVertices();
 
+    /// Lay out the text and measure the highlight rectangles, so painting doesn't measure any text.
+    void UpdateTextLayout();
+
+    /// Mark the text layout out of date, so it is made again on the next paint.
+    void InvalidateTextLayout();
+
     /// Disconnect the signal/slots associated with the "All" checkbox functionality
     void DisconnectSignals();
 
@@ -397,16 +574,28 @@ private:
     /// The number of vertices in the arrow.
     static const int kNumberOfVertices = 3;
 
-    std::unique_ptr<ListWidget> item_list_;           ///< The list of items.
-    QString                     default_text_;        ///< The default starting string.
-    QString                     selected_text_;       ///< Track selected text.
-    QString                     prefix_text_;         ///< The text that gets prefixed to the selected text.
-    bool                        allow_multi_select_;  ///< Whether this guy supports multi-selection.
-    bool show_list_above_button_;                     ///< Is the list to be displayed above the button (when the list widget is at the bottom of the screen).
-    bool retain_default_text_;                        ///< Flag to retain default text when selection changes.
-    bool all_choice_added_;                           ///< Indicates that an "All" checkbox has already been added to a multi-select combobox.
-    bool all_choice_selected_;                        ///< Does this combo box have the "All" option selected.
-    bool first_show_;                                 ///< Boolean to track the first time this widget is shown to invalidate the font metrics.
+    std::unique_ptr<ListWidget>          item_list_;           ///< The list of items.
+    std::unique_ptr<VirtualizedListView> item_view_;           ///< The virtualized list of items, if virtualized.
+    ArrowIconComboBoxModel*              item_model_;          ///< The items of the virtualized list, if virtualized.
+    ArrowIconComboBoxDelegate*           item_delegate_;       ///< The delegate painting the virtualized list, if virtualized.
+    bool                                 virtualized_;         ///< Whether the items are kept in a model rather than a list widget.
+    mutable int                          max_item_width_;      ///< The width of the longest virtualized item text, or -1 if not measured.
+    int                                  checked_count_;       ///< The number of checked checkboxes in the list widget, including "All".
+    TextSearchWidget*                    filter_edit_;         ///< The filter field at the top of the list, if enabled.
+    TextFilterIndex                      filter_index_;        ///< The index of the item texts used by the filter.
+    QVector<int>                         filter_matches_;      ///< The rows currently shown by the filter, in increasing order.
+    bool                                 filter_index_dirty_;  ///< Whether the items have changed since the filter index was built.
+    bool                                 filter_pending_;      ///< Whether the filter index is due to be built from the event loop.
+    QColor                               filter_color_;        ///< The color used to highlight the filter text in the items.
+    QString                              default_text_;        ///< The default starting string.
+    QString                              selected_text_;       ///< Track selected text.
+    QString                              prefix_text_;         ///< The text that gets prefixed to the selected text.
+    bool                                 allow_multi_select_;  ///< Whether this guy supports multi-selection.
+    bool show_list_above_button_;  ///< Is the list to be displayed above the button (when the list widget is at the bottom of the screen).
+    bool retain_default_text_;     ///< Flag to retain default text when selection changes.
+    bool all_choice_added_;        ///< Indicates that an "All" checkbox has already been added to a multi-select combobox.
+    bool all_choice_selected_;     ///< Does this combo box have the "All" option selected.
+    bool first_show_;              ///< Boolean to track the first time this widget is shown to invalidate the font metrics.
 
     int                          size_;                         ///< The size of the encompassing rect.
     QColor                       color_;                        ///< The color of the arrow's lines.
@@ -420,6 +609,12 @@ private:
     QPointF                      vertices_[kNumberOfVertices];  ///< The vertices of the arrow.
     bool                         highlight_substring_;          ///< The boolean to indicate if highlight requested.
     QVector<StringHighlightData> string_highlight_data_ = {};   ///< The vector to keep track of highlight strings.
+    bool                         text_layout_valid_;            ///< Whether the text layout matches the current font and highlights.
+    QString                      layout_text_;                  ///< The text the text layout was made for.
+    QStaticText                  static_text_;                  ///< The text, laid out for painting.
+    QVector<QRect>               highlight_rects_;              ///< The horizontal extent of each highlight, relative to the start of the text.
+    int                          text_ascent_;                  ///< The ascent of the font the text was laid out with.
+    int                          text_cap_height_;              ///< The cap height of the font the text was laid out with.
 };
 
 #endif  // QTCOMMON_CUSTOM_WIDGETS_ARROW_ICON_COMBO_BOX_H_
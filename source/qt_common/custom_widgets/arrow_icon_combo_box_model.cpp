@@ -0,0 +1,425 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of the model and delegate behind a virtualized ArrowIconComboBox list.
+//=============================================================================
+
+#include "arrow_icon_combo_box_model.h"
+
+#include <algorithm>
+
+#include <QApplication>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QStyle>
+
+/// Insert a bit into a bit array, moving the bits after it along.
+/// \param bits The bit array.
+/// \param position The position of the new bit.
+/// \param value The value of the new bit.
+static void InsertBit(QBitArray& bits, int position, bool value)
+{
+    const int size = bits.size();
+    bits.resize(size + 1);
+
+    for (int i = size; i > position; i--)
+    {
+        bits.setBit(i, bits.testBit(i - 1));
+    }
+
+    bits.setBit(position, value);
+}
+
+/// Remove a bit from a bit array, moving the bits after it back.
+/// \param bits The bit array.
+/// \param position The position of the bit to remove.
+static void RemoveBit(QBitArray& bits, int position)
+{
+    const int size = bits.size();
+
+    for (int i = position; i < (size - 1); i++)
+    {
+        bits.setBit(i, bits.testBit(i + 1));
+    }
+
+    bits.resize(size - 1);
+}
+
+ArrowIconComboBoxModel::ArrowIconComboBoxModel(QObject* parent)
+    : QAbstractListModel(parent)
+    , checked_count_(0)
+    , checkable_(false)
+{
+}
+
+ArrowIconComboBoxModel::~ArrowIconComboBoxModel()
+{
+}
+
+void ArrowIconComboBoxModel::SetCheckable(bool checkable)
+{
+    if (checkable != checkable_)
+    {
+        beginResetModel();
+        checkable_ = checkable;
+        endResetModel();
+    }
+}
+
+void ArrowIconComboBoxModel::InsertItem(int row, const QString& text, const QVariant& user_data, bool checked)
+{
+    if (row < 0 || row > texts_.size())
+    {
+        row = texts_.size();
+    }
+
+    beginInsertRows(QModelIndex(), row, row);
+
+    texts_.insert(row, text);
+    user_data_.insert(row, user_data);
+    InsertBit(checked_, row, checked);
+    InsertBit(disabled_, row, false);
+    InsertBit(hidden_, row, false);
+
+    if (checked == true)
+    {
+        checked_count_++;
+    }
+
+    endInsertRows();
+}
+
+void ArrowIconComboBoxModel::AddItems(const QStringList& texts, bool checked)
+{
+    if (texts.isEmpty() == true)
+    {
+        return;
+    }
+
+    const int first_row = texts_.size();
+    const int last_row  = first_row + texts.size() - 1;
+
+    beginInsertRows(QModelIndex(), first_row, last_row);
+
+    texts_.reserve(last_row + 1);
+    for (const QString& text : texts)
+    {
+        texts_.append(text);
+    }
+
+    user_data_.resize(last_row + 1);
+    checked_.resize(last_row + 1);
+    checked_.fill(checked, first_row, last_row + 1);
+    disabled_.resize(last_row + 1);
+    hidden_.resize(last_row + 1);
+
+    if (checked == true)
+    {
+        checked_count_ += texts.size();
+    }
+
+    endInsertRows();
+}
+
+void ArrowIconComboBoxModel::RemoveItem(int row)
+{
+    if (row < 0 || row >= texts_.size())
+    {
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row);
+
+    if (checked_.testBit(row) == true)
+    {
+        checked_count_--;
+    }
+
+    texts_.remove(row);
+    user_data_.remove(row);
+    RemoveBit(checked_, row);
+    RemoveBit(disabled_, row);
+    RemoveBit(hidden_, row);
+
+    endRemoveRows();
+}
+
+void ArrowIconComboBoxModel::Clear()
+{
+    beginResetModel();
+
+    texts_.clear();
+    user_data_.clear();
+    checked_.clear();
+    disabled_.clear();
+    hidden_.clear();
+    checked_count_ = 0;
+
+    endResetModel();
+}
+
+const QString& ArrowIconComboBoxModel::Text(int row) const
+{
+    Q_ASSERT(row >= 0 && row < texts_.size());
+    return texts_[row];
+}
+
+bool ArrowIconComboBoxModel::IsChecked(int row) const
+{
+    if (row < 0 || row >= checked_.size())
+    {
+        return false;
+    }
+
+    return checked_.testBit(row);
+}
+
+bool ArrowIconComboBoxModel::SetChecked(int row, bool checked)
+{
+    if (row < 0 || row >= checked_.size() || checked_.testBit(row) == checked)
+    {
+        return false;
+    }
+
+    checked_.setBit(row, checked);
+    checked_count_ += checked ? 1 : -1;
+
+    const QModelIndex model_index = index(row);
+    emit dataChanged(model_index, model_index, {Qt::CheckStateRole});
+
+    return true;
+}
+
+void ArrowIconComboBoxModel::SetRangeChecked(int first_row, int last_row, bool checked)
+{
+    first_row = std::max(first_row, 0);
+    last_row  = std::min(last_row, (int)checked_.size() - 1);
+
+    if (first_row > last_row)
+    {
+        return;
+    }
+
+    checked_.fill(checked, first_row, last_row + 1);
+
+    // Recount rather than test each bit of the range; counting is done a word at a time.
+    checked_count_ = checked_.count(true);
+
+    emit dataChanged(index(first_row), index(last_row), {Qt::CheckStateRole});
+}
+
+int ArrowIconComboBoxModel::CheckedCount() const
+{
+    return checked_count_;
+}
+
+bool ArrowIconComboBoxModel::IsDisabled(int row) const
+{
+    if (row < 0 || row >= disabled_.size())
+    {
+        return false;
+    }
+
+    return disabled_.testBit(row);
+}
+
+void ArrowIconComboBoxModel::SetDisabled(int row, bool disabled)
+{
+    if (row < 0 || row >= disabled_.size() || disabled_.testBit(row) == disabled)
+    {
+        return;
+    }
+
+    disabled_.setBit(row, disabled);
+
+    const QModelIndex model_index = index(row);
+    emit dataChanged(model_index, model_index);
+}
+
+bool ArrowIconComboBoxModel::IsHidden(int row) const
+{
+    if (row < 0 || row >= hidden_.size())
+    {
+        return false;
+    }
+
+    return hidden_.testBit(row);
+}
+
+void ArrowIconComboBoxModel::SetHidden(int row, bool hidden)
+{
+    if (row >= 0 && row < hidden_.size())
+    {
+        hidden_.setBit(row, hidden);
+    }
+}
+
+int ArrowIconComboBoxModel::HiddenCount() const
+{
+    return hidden_.count(true);
+}
+
+int ArrowIconComboBoxModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid() == true)
+    {
+        return 0;
+    }
+
+    return texts_.size();
+}
+
+QVariant ArrowIconComboBoxModel::data(const QModelIndex& index, int role) const
+{
+    if (index.isValid() == false || index.row() >= texts_.size())
+    {
+        return QVariant();
+    }
+
+    const int row = index.row();
+    switch (role)
+    {
+    case Qt::DisplayRole:
+        return texts_[row];
+
+    case Qt::CheckStateRole:
+        if (checkable_ == true)
+        {
+            return checked_.testBit(row) ? Qt::Checked : Qt::Unchecked;
+        }
+        break;
+
+    case Qt::UserRole:
+        return user_data_[row];
+
+    default:
+        break;
+    }
+
+    return QVariant();
+}
+
+Qt::ItemFlags ArrowIconComboBoxModel::flags(const QModelIndex& index) const
+{
+    if (index.isValid() == false || index.row() >= texts_.size())
+    {
+        return Qt::NoItemFlags;
+    }
+
+    Qt::ItemFlags item_flags = Qt::ItemIsSelectable | Qt::ItemIsEnabled;
+
+    if (checkable_ == true)
+    {
+        item_flags |= Qt::ItemIsUserCheckable;
+    }
+
+    if (disabled_.testBit(index.row()) == true)
+    {
+        item_flags.setFlag(Qt::ItemIsEnabled, false);
+    }
+
+    return item_flags;
+}
+
+bool ArrowIconComboBoxModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+    if (role != Qt::CheckStateRole || checkable_ == false || index.isValid() == false)
+    {
+        return false;
+    }
+
+    const bool checked = (static_cast<Qt::CheckState>(value.toInt()) == Qt::Checked);
+    if (SetChecked(index.row(), checked) == false)
+    {
+        return false;
+    }
+
+    emit CheckStateEdited(index.row(), checked);
+    return true;
+}
+
+ArrowIconComboBoxDelegate::ArrowIconComboBoxDelegate(QObject* parent)
+    : QStyledItemDelegate(parent)
+{
+}
+
+ArrowIconComboBoxDelegate::~ArrowIconComboBoxDelegate()
+{
+}
+
+void ArrowIconComboBoxDelegate::SetHighlight(const QString& highlight_text, const QColor& highlight_color)
+{
+    highlight_text_  = highlight_text;
+    highlight_color_ = highlight_color;
+}
+
+void ArrowIconComboBoxDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    if (highlight_text_.isEmpty() == false)
+    {
+        QStyleOptionViewItem item_option = option;
+        initStyleOption(&item_option, index);
+
+        const int highlight_start = (int)item_option.text.indexOf(highlight_text_, 0, Qt::CaseInsensitive);
+        if (highlight_start >= 0)
+        {
+            // Find where the style puts the text, then measure up to the highlight and across it.
+            const QWidget* widget      = item_option.widget;
+            const QStyle*  style       = (widget != nullptr) ? widget->style() : QApplication::style();
+            const int      text_margin = style->pixelMetric(QStyle::PM_FocusFrameHMargin, nullptr, widget) + 1;
+            const QRect    text_rect   = style->subElementRect(QStyle::SE_ItemViewItemText, &item_option, widget);
+
+            const QFontMetrics& font_metrics    = item_option.fontMetrics;
+            const int           highlight_x     = text_rect.x() + text_margin + font_metrics.horizontalAdvance(item_option.text.left(highlight_start));
+            const int           highlight_width = font_metrics.horizontalAdvance(item_option.text.mid(highlight_start, highlight_text_.size()));
+
+            painter->fillRect(QRect(highlight_x, text_rect.y(), highlight_width, text_rect.height()), highlight_color_);
+        }
+    }
+
+    QStyledItemDelegate::paint(painter, option, index);
+}
+
+bool ArrowIconComboBoxDelegate::editorEvent(QEvent* event, QAbstractItemModel* model, const QStyleOptionViewItem& option, const QModelIndex& index)
+{
+    const Qt::ItemFlags item_flags = model->flags(index);
+    if (item_flags.testFlag(Qt::ItemIsUserCheckable) == false || item_flags.testFlag(Qt::ItemIsEnabled) == false)
+    {
+        return QStyledItemDelegate::editorEvent(event, model, option, index);
+    }
+
+    switch (event->type())
+    {
+    case QEvent::MouseButtonRelease:
+    {
+        const QMouseEvent* mouse_event = static_cast<QMouseEvent*>(event);
+        if (mouse_event->button() != Qt::LeftButton || option.rect.contains(mouse_event->pos()) == false)
+        {
+            return false;
+        }
+        break;
+    }
+
+    case QEvent::MouseButtonDblClick:
+        // Swallow the second click of a double click, so it doesn't toggle the item back.
+        return true;
+
+    case QEvent::KeyPress:
+    {
+        const int key = static_cast<QKeyEvent*>(event)->key();
+        if (key != Qt::Key_Space && key != Qt::Key_Select)
+        {
+            return false;
+        }
+        break;
+    }
+
+    default:
+        return false;
+    }
+
+    const bool checked = (static_cast<Qt::CheckState>(index.data(Qt::CheckStateRole).toInt()) == Qt::Checked);
+    return model->setData(index, checked ? Qt::Unchecked : Qt::Checked, Qt::CheckStateRole);
+}
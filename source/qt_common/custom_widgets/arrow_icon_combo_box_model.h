@@ -0,0 +1,189 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for the model and delegate behind a virtualized ArrowIconComboBox list.
+//=============================================================================
+
+#ifndef QTCOMMON_CUSTOM_WIDGETS_ARROW_ICON_COMBO_BOX_MODEL_H_
+#define QTCOMMON_CUSTOM_WIDGETS_ARROW_ICON_COMBO_BOX_MODEL_H_
+
+#include <QAbstractListModel>
+#include <QBitArray>
+#include <QColor>
+#include <QStringList>
+#include <QStyledItemDelegate>
+#include <QVector>
+
+/// Model holding the items of a virtualized ArrowIconComboBox list.
+///
+/// Each item is only its text and user data; the checked, disabled and hidden states are kept
+/// in bit vectors, so a list with many thousands of items needs no per-item objects.
+class ArrowIconComboBoxModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    /// Constructor.
+    /// \param parent The parent object.
+    explicit ArrowIconComboBoxModel(QObject* parent = nullptr);
+
+    /// Destructor.
+    virtual ~ArrowIconComboBoxModel();
+
+    /// Set whether items have a checkbox.
+    /// \param checkable true for a multi-select list, false for a single-select list.
+    void SetCheckable(bool checkable);
+
+    /// Insert an item.
+    /// \param row The row to insert at. Values outside the list append the item.
+    /// \param text The text of the item.
+    /// \param user_data The user data of the item, returned for Qt::UserRole.
+    /// \param checked The initial checked state of the item.
+    void InsertItem(int row, const QString& text, const QVariant& user_data, bool checked);
+
+    /// Append several items at once.
+    /// \param texts The texts of the items.
+    /// \param checked The initial checked state of the items.
+    void AddItems(const QStringList& texts, bool checked);
+
+    /// Remove an item.
+    /// \param row The row of the item.
+    void RemoveItem(int row);
+
+    /// Remove all items.
+    void Clear();
+
+    /// Get the text of an item.
+    /// \param row The row of the item.
+    /// \return The text.
+    const QString& Text(int row) const;
+
+    /// Check whether an item is checked.
+    /// \param row The row of the item.
+    /// \return true if the item is checked, false otherwise.
+    bool IsChecked(int row) const;
+
+    /// Set the checked state of an item.
+    /// \param row The row of the item.
+    /// \param checked The new checked state.
+    /// \return true if the state changed, false otherwise.
+    bool SetChecked(int row, bool checked);
+
+    /// Set the checked state of a range of items, with a single change notification.
+    /// \param first_row The first row of the range.
+    /// \param last_row The last row of the range.
+    /// \param checked The new checked state.
+    void SetRangeChecked(int first_row, int last_row, bool checked);
+
+    /// Get the number of checked items. The count is kept up to date as items change, so this is O(1).
+    /// \return The checked item count.
+    int CheckedCount() const;
+
+    /// Check whether an item is disabled.
+    /// \param row The row of the item.
+    /// \return true if the item is disabled, false otherwise.
+    bool IsDisabled(int row) const;
+
+    /// Set whether an item is disabled.
+    /// \param row The row of the item.
+    /// \param disabled true to disable the item, false to enable it.
+    void SetDisabled(int row, bool disabled);
+
+    /// Check whether an item was hidden with ArrowIconComboBox::SetRowHidden(). The flag is kept
+    /// with the item, so it follows the item when rows are inserted or removed before it.
+    /// \param row The row of the item.
+    /// \return true if the item is hidden, false otherwise.
+    bool IsHidden(int row) const;
+
+    /// Set whether an item was hidden with ArrowIconComboBox::SetRowHidden(). The view is not
+    /// changed; the combo box shows or hides the row, taking the filter into account.
+    /// \param row The row of the item.
+    /// \param hidden true to hide the item, false to show it.
+    void SetHidden(int row, bool hidden);
+
+    /// Get the number of items hidden with ArrowIconComboBox::SetRowHidden(). Counted a word at a time.
+    /// \return The hidden item count.
+    int HiddenCount() const;
+
+    /// QAbstractListModel::rowCount() implementation.
+    /// \param parent The parent index.
+    /// \return The number of items.
+    virtual int rowCount(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+
+    /// QAbstractListModel::data() implementation.
+    /// \param index The index to query data for.
+    /// \param role The data role.
+    /// \return The data.
+    virtual QVariant data(const QModelIndex& index, int role) const Q_DECL_OVERRIDE;
+
+    /// QAbstractListModel::flags() implementation.
+    /// \param index The index to query flags for.
+    /// \return The item flags.
+    virtual Qt::ItemFlags flags(const QModelIndex& index) const Q_DECL_OVERRIDE;
+
+    /// QAbstractListModel::setData() implementation. Only the check state can be set;
+    /// this is how the view toggles items the user clicks.
+    /// \param index The index to set data for.
+    /// \param value The new value.
+    /// \param role The data role.
+    /// \return true if the data changed, false otherwise.
+    virtual bool setData(const QModelIndex& index, const QVariant& value, int role) Q_DECL_OVERRIDE;
+
+signals:
+    /// Emitted when the user changes the checked state of an item through the view.
+    /// \param row The row of the item.
+    /// \param checked The new checked state.
+    void CheckStateEdited(int row, bool checked);
+
+private:
+    QVector<QString>  texts_;          ///< The text of each item.
+    QVector<QVariant> user_data_;      ///< The user data of each item.
+    QBitArray         checked_;        ///< The checked state of each item.
+    QBitArray         disabled_;       ///< The disabled state of each item.
+    QBitArray         hidden_;         ///< Whether each item was hidden by the combo box's caller.
+    int               checked_count_;  ///< The number of checked items.
+    bool              checkable_;      ///< Whether items have a checkbox.
+};
+
+/// Delegate that paints virtualized ArrowIconComboBox items, including their checkboxes.
+///
+/// A click anywhere on a checkable item toggles it, as clicking the text of a QCheckBox does.
+class ArrowIconComboBoxDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    /// Constructor.
+    /// \param parent The parent object.
+    explicit ArrowIconComboBoxDelegate(QObject* parent = nullptr);
+
+    /// Destructor.
+    virtual ~ArrowIconComboBoxDelegate();
+
+    /// Set the text to highlight in the items, such as the filter typed by the user.
+    /// \param highlight_text The text to highlight, ignoring case. An empty string highlights nothing.
+    /// \param highlight_color The color to highlight with.
+    void SetHighlight(const QString& highlight_text, const QColor& highlight_color);
+
+    /// Paint the highlight behind the first occurrence of the highlight text, then paint the item.
+    /// \param painter The painter.
+    /// \param option The style options of the item.
+    /// \param index The index of the item.
+    virtual void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const Q_DECL_OVERRIDE;
+
+protected:
+    /// Toggle checkable items on click, or on the space key.
+    /// \param event The event.
+    /// \param model The model.
+    /// \param option The style options of the item.
+    /// \param index The index of the item.
+    /// \return true if the event was handled, false otherwise.
+    virtual bool editorEvent(QEvent* event, QAbstractItemModel* model, const QStyleOptionViewItem& option, const QModelIndex& index) Q_DECL_OVERRIDE;
+
+private:
+    QString highlight_text_;   ///< The text to highlight in the items.
+    QColor  highlight_color_;  ///< The color to highlight with.
+};
+
+#endif  // QTCOMMON_CUSTOM_WIDGETS_ARROW_ICON_COMBO_BOX_MODEL_H_
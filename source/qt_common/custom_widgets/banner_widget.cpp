@@ -10,6 +10,8 @@
 
 #include <QPainter>
 
+#include "paint_profiler.h"
+
 // Static strings used for label widgets.
 static const QString kBannerText        = "[Notification message]";
 static const QString kCloseLink         = "Close";
@@ -54,6 +56,8 @@ void BannerWidget::Init()
 
 void BannerWidget::paintEvent(QPaintEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("BannerWidget::paintEvent");
+
     QWidget::paintEvent(event);
 
     QPainter painter(this);
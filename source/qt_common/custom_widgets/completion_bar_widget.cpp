@@ -9,6 +9,7 @@
 
 #include <QPainter>
 
+#include "paint_profiler.h"
 #include "scaling_manager.h"
 
 CompletionBarWidget::CompletionBarWidget(QWidget* parent)
@@ -36,6 +37,8 @@ QSize CompletionBarWidget::sizeHint() const
 
 void CompletionBarWidget::paintEvent(QPaintEvent* paint_event)
 {
+    QTCOMMON_PROFILE_SCOPE("CompletionBarWidget::paintEvent");
+
     Q_UNUSED(paint_event);
 
     QPainter painter(this);
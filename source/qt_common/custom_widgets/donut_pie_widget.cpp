@@ -17,6 +17,7 @@
 #include <QQueue>
 
 #include "common_definitions.h"
+#include "paint_profiler.h"
 #include "qt_util.h"
 #include "scaling_manager.h"
 
@@ -46,6 +47,8 @@ QSize DonutPieWidget::sizeHint() const
 
 void DonutPieWidget::paintEvent(QPaintEvent* paint_event)
 {
+    QTCOMMON_PROFILE_SCOPE("DonutPieWidget::paintEvent");
+
     Q_UNUSED(paint_event);
 
     QPainter painter(this);
@@ -15,6 +15,7 @@
 #include <QStylePainter>
 
 #include "common_definitions.h"
+#include "paint_profiler.h"
 #include "scaling_manager.h"
 
 /// Stylesheet for the double slider widget.
@@ -707,6 +708,8 @@ void DoubleSliderWidget::mouseReleaseEvent(QMouseEvent* event)
 
 void DoubleSliderWidget::paintEvent(QPaintEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("DoubleSliderWidget::paintEvent");
+
     Q_UNUSED(event);
     QStylePainter painter(this);
 
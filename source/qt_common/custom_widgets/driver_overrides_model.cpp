@@ -108,6 +108,7 @@ namespace driver_overrides
         : key_(key)
         , value_(value)
         , parent_(parent)
+        , row_(0)
         , is_bold_(false)
     {
     }
@@ -143,6 +144,31 @@ namespace driver_overrides
 
     void TreeItem::SetKey(const QString& key)
     {
+        // Keep the parent's index of its children by key up to date. Siblings may share a key;
+        // the index holds the first of them, as the search it replaced found.
+        if (parent_ != nullptr && parent_->children_.value(row_) == this)
+        {
+            if (parent_->child_index_.value(key_) == this)
+            {
+                parent_->child_index_.remove(key_);
+
+                for (TreeItem* sibling : parent_->children_)
+                {
+                    if (sibling != this && sibling->key_ == key_)
+                    {
+                        parent_->child_index_.insert(key_, sibling);
+                        break;
+                    }
+                }
+            }
+
+            const TreeItem* indexed_item = parent_->child_index_.value(key, nullptr);
+            if (indexed_item == nullptr || indexed_item->row_ > row_)
+            {
+                parent_->child_index_.insert(key, this);
+            }
+        }
+
         key_ = key;
     }
 
@@ -173,7 +199,19 @@ namespace driver_overrides
 
     void TreeItem::AddChild(TreeItem* child)
     {
+        child->row_ = static_cast<int>(children_.size());
         children_.append(child);
+
+        // A child with the same key as an earlier sibling is only found through the earlier one.
+        if (!child_index_.contains(child->key_))
+        {
+            child_index_.insert(child->key_, child);
+        }
+    }
+
+    TreeItem* TreeItem::FindChild(const QString& key) const
+    {
+        return child_index_.value(key, nullptr);
     }
 
     TreeItem* TreeItem::GetChild(const int index) const
@@ -195,7 +233,7 @@ namespace driver_overrides
         int row = 0;
         if (parent_)
         {
-            row = parent_->children_.indexOf(const_cast<TreeItem*>(this));
+            row = row_;
         }
 
         return row;
@@ -212,6 +250,7 @@ namespace driver_overrides
                 delete child;
             }
             parent->children_.clear();
+            parent->child_index_.clear();
             result = true;
         }
 
@@ -770,14 +809,10 @@ namespace driver_overrides
             parent_item = static_cast<TreeItem*>(parent.internalPointer());
         }
 
-        for (int i = 0; i < parent_item->GetChildCount(); i++)
+        TreeItem* child_item = parent_item->FindChild(key);
+        if (child_item != nullptr)
         {
-            TreeItem* child_item = parent_item->GetChild(i);
-            if (child_item != nullptr && child_item->GetKey() == key)
-            {
-                new_index = createIndex(i, 0, child_item);
-                break;
-            }
+            new_index = createIndex(child_item->GetRow(), 0, child_item);
         }
 
         return new_index;
@@ -798,17 +833,11 @@ namespace driver_overrides
 
     TreeItem* DriverOverridesModel::AddOrUpdateChildItem(const QString& key, const QVariant& value, TreeItem* parent)
     {
-        TreeItem* item = nullptr;
-
-        // Search for a child item with the same key name. If it exists, return the existing TreeItem pointer.
-        for (int i = 0; i < parent->GetChildCount(); i++)
+        // Look up a child item with the same key name. If it exists, update and return the existing TreeItem pointer.
+        TreeItem* item = parent->FindChild(key);
+        if (item != nullptr)
         {
-            TreeItem* child_item = parent->GetChild(i);
-            if (child_item != nullptr && child_item->GetKey() == key)
-            {
-                item = child_item;
-                item->SetValue(value);
-            }
+            item->SetValue(value);
         }
 
         // If the child item does not exist, create a new TreeItem and add it to the parent.
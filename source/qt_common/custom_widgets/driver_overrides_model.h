@@ -26,6 +26,7 @@
 #include <QAbstractItemModel>
 #include <QDataWidgetMapper>
 #include <QFont>
+#include <QHash>
 #include <QJsonObject>
 #include <QList>
 #include <QModelIndex>
@@ -135,9 +136,20 @@ namespace driver_overrides
 
         /// @brief Get the row number of this item.
         ///
+        /// The row is stored in the item when it is added to its parent, so the parent's children aren't searched.
+        ///
         /// @return The row number.
         int GetRow() const;
 
+        /// @brief Find the first child with the specified key.
+        ///
+        /// Children are indexed by key, so this doesn't search the children.
+        ///
+        /// @param [in] key                             The key name of the child.
+        ///
+        /// @return The child item, or nullptr if there is no child with the key.
+        TreeItem* FindChild(const QString& key) const;
+
         /// @brief Set the key name for the item.
         ///
         /// @param [in] key                             The key name.
@@ -166,12 +178,14 @@ namespace driver_overrides
         bool RemoveAllChildren(TreeItem* parent);
 
     private:
-        QString          key_;       ///< The key name for this item.
-        QVariant         value_;     ///< The value for this item.
-        QString          tool_tip_;  ///< The tool tip for this item.
-        TreeItem*        parent_;    ///< The parent of this item.
-        QList<TreeItem*> children_;  ///< A list of the children for this item.
-        bool             is_bold_;   ///< Flag to indicate if the item should be bold.
+        QString                   key_;          ///< The key name for this item.
+        QVariant                  value_;        ///< The value for this item.
+        QString                   tool_tip_;     ///< The tool tip for this item.
+        TreeItem*                 parent_;       ///< The parent of this item.
+        QList<TreeItem*>          children_;     ///< A list of the children for this item.
+        QHash<QString, TreeItem*> child_index_;  ///< The first child of this item with each key.
+        int                       row_;          ///< The row of this item in its parent.
+        bool                      is_bold_;      ///< Flag to indicate if the item should be bold.
     };
 
     /// @brief A model that translates Driver Overrides JSON text into data viewable by a QTreeView.
@@ -11,6 +11,8 @@
 #include <QPainter>
 #include <QToolTip>
 
+#include "paint_profiler.h"
+
 ElidedLineLabel::ElidedLineLabel(QWidget* parent)
     : ScaledLabel(parent)
 {
@@ -33,6 +35,8 @@ QString ElidedLineLabel::text() const
 
 void ElidedLineLabel::resizeEvent(QResizeEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("ElidedLineLabel::resizeEvent");
+
     QLabel::resizeEvent(event);
     UpdateLabelText();
 }
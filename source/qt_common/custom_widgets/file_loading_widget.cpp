@@ -15,6 +15,7 @@
 #include <QPaintEvent>
 #include <QPainter>
 
+#include "paint_profiler.h"
 #include "scaling_manager.h"
 
 /// Speed of the animation.
@@ -211,6 +212,8 @@ QSize FileLoadingWidget::sizeHint() const
 
 void FileLoadingWidget::resizeEvent(QResizeEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("FileLoadingWidget::resizeEvent");
+
     // Recreate Animation bars with the new size.
     // Temporarily disconnect and stop the timer while the bars gets recreated.
     if (animated_bars_ != nullptr)
@@ -237,6 +240,8 @@ void FileLoadingWidget::Animate()
 
 void FileLoadingWidget::paintEvent(QPaintEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("FileLoadingWidget::paintEvent");
+
     Q_UNUSED(event);
 
     QPainter painter(this);
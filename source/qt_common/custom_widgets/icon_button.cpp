@@ -14,6 +14,7 @@
 #include <QStyleOptionButton>
 #include <QStylePainter>
 
+#include "paint_profiler.h"
 #include "scaling_manager.h"
 
 IconButton::IconButton(QWidget* parent)
@@ -78,6 +79,8 @@ QSize IconButton::sizeHint() const
 
 void IconButton::paintEvent(QPaintEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("IconButton::paintEvent");
+
     Q_UNUSED(event);
 
     QStylePainter painter(this);
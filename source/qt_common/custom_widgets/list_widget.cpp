@@ -16,6 +16,7 @@
 #include <QScrollBar>
 
 #include "common_definitions.h"
+#include "paint_profiler.h"
 #include "qt_util.h"
 #include "scaling_manager.h"
 
@@ -29,6 +30,7 @@ ListWidget::ListWidget(QWidget* parent)
     , hide_(false)
     , parent_(parent)
     , show_list_above_button_(false)
+    , header_widget_(nullptr)
 {
     connect(&ScalingManager::Get(), &ScalingManager::ScaleFactorChanged, this, &ListWidget::OnScaleFactorChanged);
 }
@@ -39,6 +41,7 @@ ListWidget::ListWidget(QWidget* parent, ArrowIconComboBox* button, bool hide)
     , hide_(hide)
     , parent_(parent)
     , show_list_above_button_(false)
+    , header_widget_(nullptr)
 {
     connect(qApp, &QApplication::focusChanged, this, &ListWidget::FocusChanged);
     connect(&ScalingManager::Get(), &ScalingManager::ScaleFactorChanged, this, &ListWidget::OnScaleFactorChanged);
@@ -129,6 +132,8 @@ void ListWidget::UpdateSize()
 
     this->updateGeometry();
     this->resize(sizeHint());
+
+    LayoutHeaderWidget();
 }
 
 int ListWidget::GetListWidgetHeight() const
@@ -137,10 +142,19 @@ int ListWidget::GetListWidgetHeight() const
     int height = 0;
     for (int loop = 0; loop < count; loop++)
     {
-        height += this->sizeHintForRow(loop);
+        // Hidden rows take no space.
+        if (this->isRowHidden(loop) == false)
+        {
+            height += this->sizeHintForRow(loop);
+        }
     }
     height += this->frameWidth() * 2;
 
+    if (header_widget_ != nullptr)
+    {
+        height += header_widget_->sizeHint().height();
+    }
+
     return height;
 }
 
@@ -173,6 +187,8 @@ void ListWidget::showEvent(QShowEvent* event)
 
 void ListWidget::paintEvent(QPaintEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("ListWidget::paintEvent");
+
     // Calculate the position when painting just in case the parent pane
     // has scrolled and the widget needs to be moved accordingly.
     RepositionListWidget();
@@ -185,41 +201,66 @@ void ListWidget::RepositionListWidget()
 {
     if (button_ != nullptr)
     {
-        QRect  button_rect   = button_->geometry();
-        QPoint list_position = button_->mapTo(parent_, QPoint(0, 0));
+        // Move list to the new position
+        this->move(PopupListPosition(this, button_, parent_, show_list_above_button_));
+    }
+}
 
-        list_position.setY(list_position.y() + button_rect.height());
+QPoint ListWidget::PopupListPosition(const QWidget* list, const QWidget* button, const QWidget* parent, bool list_above_button)
+{
+    QRect  button_rect   = button->geometry();
+    QPoint list_position = button->mapTo(parent, QPoint(0, 0));
 
-        // if list box is to go above the button, reposition the list
-        if (show_list_above_button_ == true)
-        {
-            list_position.setY(list_position.y() - button_rect.height() - height());
-        }
+    list_position.setY(list_position.y() + button_rect.height());
+
+    // if list box is to go above the button, reposition the list
+    if (list_above_button == true)
+    {
+        list_position.setY(list_position.y() - button_rect.height() - list->height());
+    }
 
-        // If the list would extend off the edge of the window, then constrain
-        // the list to the window.
-        for (QWidget* widget : QApplication::topLevelWidgets())
+    // If the list would extend off the edge of the window, then constrain
+    // the list to the window.
+    for (QWidget* widget : QApplication::topLevelWidgets())
+    {
+        if (widget->inherits("QMainWindow"))
         {
-            if (widget->inherits("QMainWindow"))
+            QMainWindow* main_window = qobject_cast<QMainWindow*>(widget);
+
+            if (main_window != nullptr)
             {
-                QMainWindow* main_window = qobject_cast<QMainWindow*>(widget);
+                QRect window_rect = main_window->rect();
 
-                if (main_window != nullptr)
+                if (list_position.x() + list->width() > window_rect.right())
                 {
-                    QRect window_rect = main_window->rect();
-
-                    if (list_position.x() + width() > window_rect.right())
-                    {
-                        list_position.setX(window_rect.right() - width());
-                    }
-                    break;
+                    list_position.setX(window_rect.right() - list->width());
                 }
+                break;
             }
         }
+    }
 
-        // Move list to the new position
-        this->move(list_position);
+    return list_position;
+}
+
+int ListWidget::PlacePopupHeader(QFrame* list, QWidget* header_widget)
+{
+    if (header_widget == nullptr)
+    {
+        return 0;
     }
+
+    // Reparenting hides a widget, so only reparent a new header widget.
+    if (header_widget->parentWidget() != list)
+    {
+        header_widget->setParent(list);
+        header_widget->show();
+    }
+
+    const int header_height = header_widget->sizeHint().height();
+    header_widget->setGeometry(list->frameWidth(), list->frameWidth(), list->width() - 2 * list->frameWidth(), header_height);
+
+    return header_height;
 }
 
 void ListWidget::AddItem(const QString& label)
@@ -234,6 +275,17 @@ void ListWidget::AddItem(const QString& label)
     QListWidget::setItemWidget(item, scaled_label);
 }
 
+void ListWidget::SetHeaderWidget(QWidget* header_widget)
+{
+    header_widget_ = header_widget;
+    LayoutHeaderWidget();
+}
+
+void ListWidget::LayoutHeaderWidget()
+{
+    setViewportMargins(0, PlacePopupHeader(this, header_widget_), 0, 0);
+}
+
 void ListWidget::SetParent(QWidget* parent)
 {
     parent_ = parent;
@@ -400,3 +452,10 @@ void ListWidget::focusOutEvent(QFocusEvent* event)
     // Pass the event onto the base class.
     QListWidget::focusOutEvent(event);
 }
+
+void ListWidget::resizeEvent(QResizeEvent* event)
+{
+    QListWidget::resizeEvent(event);
+
+    LayoutHeaderWidget();
+}
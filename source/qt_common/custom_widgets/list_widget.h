@@ -48,6 +48,10 @@ public:
     /// \param label The string to be added to the list.
     void AddItem(const QString& label);
 
+    /// Set a widget to show above the items, such as a filter field.
+    /// \param header_widget The widget. The list becomes its parent.
+    void SetHeaderWidget(QWidget* header_widget);
+
     /// When the ListWidget is shown, reposition it relative to the parent button
     /// so that it is initially painted in the correct location.
     /// \param event The Qt show event
@@ -69,6 +73,10 @@ public:
     /// \param event The focus event.
     virtual void focusOutEvent(QFocusEvent* event) Q_DECL_OVERRIDE;
 
+    /// Overridden resizeEvent, to keep the header widget across the top of the list.
+    /// \param event The resize event.
+    virtual void resizeEvent(QResizeEvent* event) Q_DECL_OVERRIDE;
+
     /// Overridden sizeHint that accounts for all the items in the list.
     /// \return The preferred size for this list widget.
     virtual QSize sizeHint() const Q_DECL_OVERRIDE;
@@ -86,6 +94,21 @@ public:
     /// \return The width of the list widget
     int GetListWidgetWidth() const;
 
+    /// Calculate where a pop-up list belongs relative to the button that opens it.
+    /// \param list The pop-up list.
+    /// \param button The button that opens the list.
+    /// \param parent The widget the list is positioned in.
+    /// \param list_above_button If true, the list goes above the button; otherwise below it.
+    /// \return The position of the list, in the coordinates of parent.
+    static QPoint PopupListPosition(const QWidget* list, const QWidget* button, const QWidget* parent, bool list_above_button);
+
+    /// Place a header widget across the top of a pop-up list, inside its frame, making the list its parent.
+    /// The list should then set its top viewport margin to the returned height, so the items start below it.
+    /// \param list The pop-up list.
+    /// \param header_widget The header widget, or nullptr for none.
+    /// \return The height of the header widget, or 0 if there is none.
+    static int PlacePopupHeader(QFrame* list, QWidget* header_widget);
+
     /// Add a check box item to the list widget.
     /// \param text The text of the check box.
     /// \param list_widget The list widget to add the check box to.
@@ -137,9 +160,13 @@ private:
     /// associated with.
     void RepositionListWidget();
 
+    /// Place the header widget above the items, and leave room for it.
+    void LayoutHeaderWidget();
+
     bool     hide_;                    ///< The hide flag to hide the widget on focusChanged event.
     QWidget* parent_;                  ///< The parent object.
     bool     show_list_above_button_;  ///< Show the list widget above the button (true) or below (false).
+    QWidget* header_widget_;           ///< The widget shown above the items, or nullptr.
 };
 
 #endif  // QTCOMMON_CUSTOM_WIDGETS_LIST_WIDGET_H_
@@ -13,6 +13,8 @@
 #include <QGraphicsEffect>
 #include <QThread>
 
+#include "paint_profiler.h"
+
 /// @brief The number of milliseconds between each poll of the message overlay queue.
 static constexpr int kMessageOverlayQueuePollInterval = 50;
 
@@ -94,6 +96,8 @@ void MessageOverlayContainer::OverlayFinished(int result)
 
 void MessageOverlayContainer::resizeEvent(QResizeEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("MessageOverlayContainer::resizeEvent");
+
     QWidget::resizeEvent(event);
 
     for (auto i = active_overlays_.begin(); i != active_overlays_.end(); i++)
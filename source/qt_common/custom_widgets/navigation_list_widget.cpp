@@ -13,17 +13,19 @@
 
 #include "common_definitions.h"
 #include "scaling_manager.h"
+#include "style_sheet_registry.h"
 #include "qt_util.h"
 
 NavigationListWidget::NavigationListWidget(QWidget* parent)
     : QListWidget(parent)
 {
     setMouseTracking(true);
-    SetStyleSheet();
 
-    connect(&ScalingManager::Get(), &ScalingManager::ScaleFactorChanged, this, &NavigationListWidget::OnScaleFactorChanged);
+    StyleSheetRegistry::Get().Register(this, [this]() {
+        return (QtCommon::QtUtils::ColorTheme::Get().GetColorTheme() == kColorThemeTypeLight) ? kMainListWidgetStylesheet_ : kMainListWidgetDarkStylesheet_;
+    });
 
-    connect(&QtCommon::QtUtils::ColorTheme::Get(), &QtCommon::QtUtils::ColorTheme::ColorThemeUpdated, this, &NavigationListWidget::SetStyleSheet);
+    connect(&ScalingManager::Get(), &ScalingManager::ScaleFactorChanged, this, &NavigationListWidget::OnScaleFactorChanged);
 }
 
 NavigationListWidget::~NavigationListWidget()
@@ -106,12 +108,5 @@ void NavigationListWidget::OnScaleFactorChanged()
 
 void NavigationListWidget::SetStyleSheet()
 {
-    if (QtCommon::QtUtils::ColorTheme::Get().GetColorTheme() == kColorThemeTypeLight)
-    {
-        setStyleSheet(kMainListWidgetStylesheet_);
-    }
-    else
-    {
-        setStyleSheet(kMainListWidgetDarkStylesheet_);
-    }
+    StyleSheetRegistry::Get().Refresh(this);
 }
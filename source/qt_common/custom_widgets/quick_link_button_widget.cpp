@@ -15,6 +15,7 @@
 #include <QStylePainter>
 
 #include "common_definitions.h"
+#include "paint_profiler.h"
 #include "qt_util.h"
 #include "scaling_manager.h"
 
@@ -72,6 +73,8 @@ QSize QuickLinkButtonWidget::sizeHint() const
 
 void QuickLinkButtonWidget::paintEvent(QPaintEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("QuickLinkButtonWidget::paintEvent");
+
     Q_UNUSED(event);
 
     QPainter painter(this);
@@ -83,9 +86,11 @@ void QuickLinkButtonWidget::paintEvent(QPaintEvent* event)
     QFont desc_font(painter.font());
     desc_font.setBold(false);
 
+    const DefaultThemeColors& theme_colors = QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors();
+
     // Draw background for the button.
-    painter.setPen(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().quick_link_button_background_color);
-    painter.setBrush(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().quick_link_button_background_color);
+    painter.setPen(theme_colors.quick_link_button_background_color);
+    painter.setBrush(theme_colors.quick_link_button_background_color);
 
     painter.drawRect(0, 0, width(), height());
 
@@ -100,11 +105,11 @@ void QuickLinkButtonWidget::paintEvent(QPaintEvent* event)
 
     if (highlighted_)
     {
-        painter.setPen(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().link_text_color);
+        painter.setPen(theme_colors.link_text_color);
     }
     else
     {
-        painter.setPen(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().graphics_scene_text_color);
+        painter.setPen(theme_colors.graphics_scene_text_color);
     }
 
     y_offset += painter.fontMetrics().ascent();
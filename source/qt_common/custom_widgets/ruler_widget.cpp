@@ -10,6 +10,7 @@
 #include <math.h> /* log2 */
 #include <QtWidgets>
 
+#include "paint_profiler.h"
 #include "qt_util.h"
 #include "scaling_manager.h"
 
@@ -21,6 +22,15 @@ static const double kMaximumTickStep = 10.0;
 
 static const float kRulerFontPointSize = 8.25f;
 
+/// The number of ruler layouts to keep. More than one allows several rulers, such as a
+/// timeline and a rulered table header, to be painted alternately without thrashing.
+static const int kLayoutCacheSize = 4;
+
+/// The number of label images to keep before the cache is flushed.
+static const int kMaxCachedLabelPixmaps = 1024;
+
+bool RulerWidget::batched_tick_drawing_ = true;
+
 void RulerWidget::PaintRulerBackground(QPainter* painter, const QRectF& rect)
 {
     painter->save();
@@ -28,8 +38,9 @@ void RulerWidget::PaintRulerBackground(QPainter* painter, const QRectF& rect)
     auto pen   = painter->pen();
     auto brush = painter->brush();
 
-    pen.setColor(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().ruler_edge_color);
-    brush.setColor(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().ruler_background_color);
+    const DefaultThemeColors& theme_colors = QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors();
+    pen.setColor(theme_colors.ruler_edge_color);
+    brush.setColor(theme_colors.ruler_background_color);
 
     pen.setCosmetic(true); // Don't scale.
 
@@ -41,6 +52,16 @@ void RulerWidget::PaintRulerBackground(QPainter* painter, const QRectF& rect)
     painter->restore();
 }
 
+void RulerWidget::SetBatchedTickDrawing(bool enabled)
+{
+    batched_tick_drawing_ = enabled;
+}
+
+bool RulerWidget::IsBatchedTickDrawingEnabled()
+{
+    return batched_tick_drawing_;
+}
+
 double RulerWidget::GetStartingTime(double min_visible_time, uint64_t time_period, bool use_time_period)
 {
     if (use_time_period == false)
@@ -53,27 +74,79 @@ double RulerWidget::GetStartingTime(double min_visible_time, uint64_t time_perio
     }
 }
 
-void RulerWidget::PaintRuler(QPainter*     painter,
-                             const QRectF& rect,
-                             uint64_t      max_time,
-                             uint64_t      min_visible_clk,
-                             uint64_t      max_visible_clk,
-                             double        time_to_clk_ratio,
-                             int           unit_type,
-                             bool          use_time_period)
+/// A single tick mark in a ruler layout.
+struct RulerTick
 {
-    painter->save();
+    double x_pos;        ///< The x-coordinate of the tick.
+    int    top;          ///< The y-coordinate of the top of the tick.
+    int    label_index;  ///< The index of the tick label, or -1 if the tick has no label.
+};
 
-    auto font = painter->font();
-    font.setPointSizeF(kRulerFontPointSize);
-    painter->setFont(font);
+struct RulerWidget::Layout
+{
+    Layout()
+        : max_time(0)
+        , min_visible_clk(0)
+        , max_visible_clk(0)
+        , time_to_clk_ratio(0)
+        , unit_type(0)
+        , use_time_period(false)
+        , valid(false)
+        , bottom(0)
+    {
+    }
 
-    auto pen = painter->pen();
+    QRectF   rect;               ///< Key: the rect encompassing the whole ruler.
+    uint64_t max_time;           ///< Key: the maximum clock value.
+    uint64_t min_visible_clk;    ///< Key: the minimum visible clock value.
+    uint64_t max_visible_clk;    ///< Key: the maximum visible clock value.
+    double   time_to_clk_ratio;  ///< Key: the time to clock ratio.
+    int      unit_type;          ///< Key: the time unit.
+    bool     use_time_period;    ///< Key: whether the time period is used for the starting time.
+    bool     valid;              ///< Whether this layout holds data.
+
+    int                bottom;  ///< The y-coordinate of the bottom of every tick.
+    QVector<RulerTick> ticks;   ///< The tick marks, from left to right.
+    QVector<QLineF>    lines;   ///< The tick lines, for drawing in a single call.
+    QVector<QString>   labels;  ///< The text of the labelled ticks.
+};
+
+const RulerWidget::Layout& RulerWidget::GetLayout(const QRectF& rect,
+                                                  uint64_t      max_time,
+                                                  uint64_t      min_visible_clk,
+                                                  uint64_t      max_visible_clk,
+                                                  double        time_to_clk_ratio,
+                                                  int           unit_type,
+                                                  bool          use_time_period)
+{
+    static Layout layout_cache[kLayoutCacheSize];
+    static int    next_cache_slot = 0;
 
-    pen.setColor(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().ruler_marker_color);
-    pen.setCosmetic(true); // Don't scale.
+    for (const Layout& cached_layout : layout_cache)
+    {
+        if (cached_layout.valid && cached_layout.rect == rect && cached_layout.max_time == max_time && cached_layout.min_visible_clk == min_visible_clk &&
+            cached_layout.max_visible_clk == max_visible_clk && cached_layout.time_to_clk_ratio == time_to_clk_ratio && cached_layout.unit_type == unit_type &&
+            cached_layout.use_time_period == use_time_period)
+        {
+            return cached_layout;
+        }
+    }
 
-    painter->setPen(pen);
+    Layout& layout  = layout_cache[next_cache_slot];
+    next_cache_slot = (next_cache_slot + 1) % kLayoutCacheSize;
+
+    layout.rect              = rect;
+    layout.max_time          = max_time;
+    layout.min_visible_clk   = min_visible_clk;
+    layout.max_visible_clk   = max_visible_clk;
+    layout.time_to_clk_ratio = time_to_clk_ratio;
+    layout.unit_type         = unit_type;
+    layout.use_time_period   = use_time_period;
+    layout.valid             = true;
+    layout.bottom            = rect.bottom() - 1;
+    layout.ticks.clear();
+    layout.lines.clear();
+    layout.labels.clear();
 
     // convert maxtime, minvisible, maxvisible to nanoseconds if time units not clock
     // This is so the ruler scaling can be done using the time units specified and
@@ -142,47 +215,35 @@ void RulerWidget::PaintRuler(QPainter*     painter,
         while (clock_label <= (max_visible_time + scale_increment))
         {
             const bool perform_draw = (clock_label >= starting_time);
-            int        top;
 
-            // long marker
-            if ((count % markers_per_section) == 0)
+            if (perform_draw == true)
             {
-                top = rect.bottom() - (marker_unit_height * 4);
+                RulerTick tick;
+                tick.x_pos       = x_pos;
+                tick.label_index = -1;
 
-                // draw the text if visible
-                if (perform_draw == true)
+                // long marker
+                if ((count % markers_per_section) == 0)
                 {
-                    // Use the world transform to translate to the place we want the text to be,
-                    // render the text, then reset the translation.
-                    QTransform wt = painter->worldTransform();
-                    wt.translate(x_pos, 0);
-                    painter->setWorldTransform(wt);
-                    painter->drawText(1, top - (marker_unit_height * 2), QtCommon::QtUtils::ClockToTimeUnit(clock_label, unit_type));
-                    wt.translate(-x_pos, 0);
-                    painter->setWorldTransform(wt);
+                    tick.top         = rect.bottom() - (marker_unit_height * 4);
+                    tick.label_index = layout.labels.size();
+                    layout.labels.append(QtCommon::QtUtils::ClockToTimeUnit(clock_label, unit_type));
                 }
-            }
 
-            // mid marker
-            else if ((count % 10) == 0)
-            {
-                top = rect.bottom() - (marker_unit_height * 3);
-            }
+                // mid marker
+                else if ((count % 10) == 0)
+                {
+                    tick.top = rect.bottom() - (marker_unit_height * 3);
+                }
 
-            // short marker
-            else
-            {
-                top = rect.bottom() - (marker_unit_height * 2);
-            }
+                // short marker
+                else
+                {
+                    tick.top = rect.bottom() - (marker_unit_height * 2);
+                }
 
-            if (perform_draw == true)
-            {
-                QTransform wt = painter->worldTransform();
-                wt.translate(x_pos, 0);
-                painter->setWorldTransform(wt);
-                painter->drawLine(1, top, 1, rect.bottom() - 1);
-                wt.translate(-x_pos, 0);
-                painter->setWorldTransform(wt);
+                layout.ticks.append(tick);
+                layout.lines.append(QLineF(tick.x_pos + 1, tick.top, tick.x_pos + 1, layout.bottom));
             }
 
             clock_label += scale_increment;
@@ -190,6 +251,93 @@ void RulerWidget::PaintRuler(QPainter*     painter,
             x_pos += tick_step;
         }
     }
+
+    return layout;
+}
+
+const QPixmap& RulerWidget::GetLabelPixmap(const QString& text, const QFont& font, const QColor& color, qreal device_pixel_ratio)
+{
+    static QHash<QString, QPixmap> label_cache;
+
+    const QString key = text + QChar('\n') + font.key() + QChar('\n') + QString::number(color.rgba()) + QChar('\n') + QString::number(device_pixel_ratio);
+
+    auto iter = label_cache.constFind(key);
+    if (iter != label_cache.constEnd())
+    {
+        return iter.value();
+    }
+
+    if (label_cache.size() >= kMaxCachedLabelPixmaps)
+    {
+        label_cache.clear();
+    }
+
+    const QFontMetricsF font_metrics(font);
+    const QSizeF        label_size(font_metrics.horizontalAdvance(text) + 2, font_metrics.height());
+
+    QPixmap pixmap((label_size * device_pixel_ratio).toSize());
+    pixmap.setDevicePixelRatio(device_pixel_ratio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter label_painter(&pixmap);
+    label_painter.setFont(font);
+    label_painter.setPen(color);
+    label_painter.drawText(QPointF(0, font_metrics.ascent()), text);
+    label_painter.end();
+
+    return label_cache.insert(key, pixmap).value();
+}
+
+void RulerWidget::PaintRuler(QPainter*     painter,
+                             const QRectF& rect,
+                             uint64_t      max_time,
+                             uint64_t      min_visible_clk,
+                             uint64_t      max_visible_clk,
+                             double        time_to_clk_ratio,
+                             int           unit_type,
+                             bool          use_time_period)
+{
+    const Layout& layout = GetLayout(rect, max_time, min_visible_clk, max_visible_clk, time_to_clk_ratio, unit_type, use_time_period);
+
+    painter->save();
+
+    auto font = painter->font();
+    font.setPointSizeF(kRulerFontPointSize);
+    painter->setFont(font);
+
+    auto pen = painter->pen();
+
+    pen.setColor(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().ruler_marker_color);
+    pen.setCosmetic(true); // Don't scale.
+
+    painter->setPen(pen);
+
+    const qreal         device_pixel_ratio = (painter->device() != nullptr) ? painter->device()->devicePixelRatioF() : 1.0;
+    const QFontMetricsF font_metrics(font);
+    const int           marker_unit_height = rect.height() / 8;
+
+    for (const RulerTick& tick : layout.ticks)
+    {
+        // draw the text if this is a long marker
+        if (tick.label_index >= 0)
+        {
+            const QPixmap& label_pixmap = GetLabelPixmap(layout.labels[tick.label_index], font, pen.color(), device_pixel_ratio);
+            const int      baseline     = tick.top - (marker_unit_height * 2);
+            painter->drawPixmap(QPointF(tick.x_pos + 1, baseline - font_metrics.ascent()), label_pixmap);
+        }
+
+        if (batched_tick_drawing_ == false)
+        {
+            painter->drawLine(QLineF(tick.x_pos + 1, tick.top, tick.x_pos + 1, layout.bottom));
+        }
+    }
+
+    // Short, mid and long markers share the same pen, so submit them all at once.
+    if (batched_tick_drawing_ == true)
+    {
+        painter->drawLines(layout.lines);
+    }
+
     painter->restore();
 }
 
@@ -228,6 +376,8 @@ void RulerWidget::UpdateVisibleBounds(uint64_t min_clk, uint64_t max_clk)
 
 void RulerWidget::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
+    QTCOMMON_PROFILE_SCOPE("RulerWidget::paint");
+
     Q_UNUSED(option);
     Q_UNUSED(widget);
 
@@ -13,6 +13,8 @@
 #include "qt_common/utils/common_definitions.h"
 
 class QColor;
+class QFont;
+class QPixmap;
 
 struct RulerConfig
 {
@@ -60,6 +62,15 @@ public:
     /// \param rect The rect encompassing the whole ruler
     static void PaintRulerBackground(QPainter* painter, const QRectF& rect);
 
+    /// Set whether PaintRuler submits all of the tick lines in a single draw call,
+    /// rather than drawing each tick individually. Enabled by default.
+    /// \param enabled Whether batched tick drawing is enabled.
+    static void SetBatchedTickDrawing(bool enabled);
+
+    /// Get whether PaintRuler submits all of the tick lines in a single draw call.
+    /// \return true if batched tick drawing is enabled, false otherwise.
+    static bool IsBatchedTickDrawingEnabled();
+
     /// Constructor
     /// \param config Ruler configuration
     RulerWidget(const RulerConfig& config);
@@ -93,6 +104,38 @@ public:
     void UpdateVisibleBounds(uint64_t min_clk, uint64_t max_clk);
 
 private:
+    /// The cached tick and label positions for a ruler paint.
+    struct Layout;
+
+    /// Get the tick and label layout for the given ruler parameters. The most recently
+    /// used layouts are cached, so repainting an unchanged ruler does no layout work.
+    /// Must only be called from the GUI thread.
+    /// \param rect The rect encompassing the whole ruler
+    /// \param max_time The maximum clock value
+    /// \param min_visible_clk The minimum visible clock value
+    /// \param max_visible_clk The maximum visible clock value
+    /// \param time_to_clk_ratio The time to clock ratio
+    /// \param unit_type Working with clk, ns, us, or ms
+    /// \param use_time_period A flag indicating whether the time period should be
+    ///  used in the calculation of the starting time
+    /// \return The layout.
+    static const Layout& GetLayout(const QRectF& rect,
+                                   uint64_t      max_time,
+                                   uint64_t      min_visible_clk,
+                                   uint64_t      max_visible_clk,
+                                   double        time_to_clk_ratio,
+                                   int           unit_type,
+                                   bool          use_time_period);
+
+    /// Get a pre-rendered image of a ruler label. Images are cached by text, font,
+    /// color and device pixel ratio. Must only be called from the GUI thread.
+    /// \param text The label text.
+    /// \param font The label font.
+    /// \param color The label color.
+    /// \param device_pixel_ratio The device pixel ratio of the paint device.
+    /// \return The label image, with the text baseline at the font ascent.
+    static const QPixmap& GetLabelPixmap(const QString& text, const QFont& font, const QColor& color, qreal device_pixel_ratio);
+
     /// Get the start time of the ruler. A different value is needed for ruler
     /// widgets attached to GraphicScene objects and QTreeView headers.
     /// \param min_visible_time The minimum time visible on the ruler
@@ -102,6 +145,9 @@ private:
     ///  used in the calculation
     static double GetStartingTime(double min_visible_time, uint64_t time_period, bool use_time_period);
 
+    /// Whether the tick lines are drawn with a single draw call.
+    static bool batched_tick_drawing_;
+
     /// Ruler config/setup
     RulerConfig config_;
 
@@ -9,6 +9,7 @@
 #include "common_definitions.h"
 #include "qt_util.h"
 #include "scaling_manager.h"
+#include "style_sheet_registry.h"
 
 ScaledPushButton::ScaledPushButton(QWidget* parent)
     : QPushButton(parent)
@@ -54,14 +55,12 @@ void ScaledPushButton::OnScaleFactorChanged()
 
 void ScaledPushButton::SetLinkStyleSheet()
 {
-   connect(&QtCommon::QtUtils::ColorTheme::Get(), &QtCommon::QtUtils::ColorTheme::ColorThemeUpdated, this, &ScaledPushButton::UpdateLinkButtonStyleSheet);
-
-   UpdateLinkButtonStyleSheet();
+    StyleSheetRegistry::Get().Register(this, []() { return QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().link_button_style_sheet; });
 }
 
 void ScaledPushButton::UpdateLinkButtonStyleSheet()
 {
-    setStyleSheet(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().link_button_style_sheet);
+    StyleSheetRegistry::Get().Apply(this, QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().link_button_style_sheet);
 }
 
 
@@ -7,6 +7,7 @@
 //=============================================================================
 
 #include "tab_widget.h"
+#include "paint_profiler.h"
 #include "scaling_manager.h"
 
 #include <QResizeEvent>
@@ -39,6 +40,8 @@ int TabWidget::TabHeight() const
 
 void TabWidget::resizeEvent(QResizeEvent* resize_event)
 {
+    QTCOMMON_PROFILE_SCOPE("TabWidget::resizeEvent");
+
     tab_bar_.resize(resize_event->size());
     QTabWidget::resizeEvent(resize_event);
 }
@@ -9,6 +9,7 @@
 
 #include "common_definitions.h"
 #include "scaling_manager.h"
+#include "style_sheet_registry.h"
 
 static const QString kTextSearchStylesheet =
     "QLineEdit {\
@@ -23,7 +24,7 @@ TextSearchWidget::TextSearchWidget(QWidget* parent)
 {
     search_action_ = addAction(QIcon(kSearchIconResource), QLineEdit::TrailingPosition);
 
-    setStyleSheet(kTextSearchStylesheet);
+    StyleSheetRegistry::Get().Apply(this, kTextSearchStylesheet);
 
     // connect text changed signal/slot
     connect(this, &TextSearchWidget::textChanged, this, &TextSearchWidget::HandleTextChanged);
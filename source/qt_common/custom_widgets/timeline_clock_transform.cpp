@@ -0,0 +1,191 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of a fixed-point clock to scene coordinate transform.
+//=============================================================================
+
+#include "timeline_clock_transform.h"
+
+#if !defined(__SIZEOF_INT128__) && defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+/// Get the high 64 bits of the 128-bit product of two 64-bit values.
+/// \param lhs The first value.
+/// \param rhs The second value.
+/// \return The high half of the product.
+static inline quint64 MultiplyHigh(quint64 lhs, quint64 rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    return (quint64)(((unsigned __int128)lhs * rhs) >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return __umulh(lhs, rhs);
+#else
+    const quint64 lhs_low  = lhs & 0xffffffff;
+    const quint64 lhs_high = lhs >> 32;
+    const quint64 rhs_low  = rhs & 0xffffffff;
+    const quint64 rhs_high = rhs >> 32;
+
+    const quint64 low_low   = lhs_low * rhs_low;
+    const quint64 low_high  = lhs_low * rhs_high;
+    const quint64 high_low  = lhs_high * rhs_low;
+    const quint64 high_high = lhs_high * rhs_high;
+
+    const quint64 middle = (low_low >> 32) + (low_high & 0xffffffff) + (high_low & 0xffffffff);
+    return high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+#endif
+}
+
+TimelineClockTransform::TimelineClockTransform()
+    : max_clock_(0)
+    , scene_width_(0)
+    , scene_offset_(0)
+    , clock_to_scene_(MakeRatio(0, 0))
+    , scene_to_clock_(MakeRatio(0, 0))
+{
+}
+
+TimelineClockTransform::~TimelineClockTransform()
+{
+}
+
+TimelineClockTransform::Ratio TimelineClockTransform::MakeRatio(quint64 numerator, quint64 divisor)
+{
+    Ratio ratio = {0, 0, 0, 0};
+
+    if (divisor == 0)
+    {
+        return ratio;
+    }
+
+    ratio.integer_part = numerator / divisor;
+    ratio.remainder    = numerator % divisor;
+    ratio.divisor      = divisor;
+
+    // Long division of remainder * 2^64 by the divisor, one bit at a time. This only runs
+    // when the mapping changes. The divisor is at most 2^63, so the shift can't overflow.
+    quint64 partial = ratio.remainder;
+    for (int bit = 0; bit < 64; bit++)
+    {
+        partial <<= 1;
+        ratio.fraction <<= 1;
+
+        if (partial >= divisor)
+        {
+            partial -= divisor;
+            ratio.fraction |= 1;
+        }
+    }
+
+    return ratio;
+}
+
+quint64 TimelineClockTransform::Scale(const Ratio& ratio, quint64 value, bool round_up)
+{
+    // The fixed-point fraction is rounded down, so the estimate of
+    // floor(value * remainder / divisor) is either exact or one too small.
+    quint64 fraction_part = MultiplyHigh(value, ratio.fraction);
+
+    // The true remainder of the division is below 2 * divisor, so it can be computed
+    // exactly from the low 64 bits of each product.
+    quint64 leftover = (value * ratio.remainder) - (fraction_part * ratio.divisor);
+    if (leftover >= ratio.divisor)
+    {
+        fraction_part++;
+        leftover -= ratio.divisor;
+    }
+
+    if (round_up && leftover != 0)
+    {
+        fraction_part++;
+    }
+
+    return (value * ratio.integer_part) + fraction_part;
+}
+
+qint64 TimelineClockTransform::ScaleSigned(const Ratio& ratio, qint64 value, bool round_up)
+{
+    if (value < 0)
+    {
+        return -(qint64)Scale(ratio, 0 - (quint64)value, round_up);
+    }
+
+    return (qint64)Scale(ratio, (quint64)value, round_up);
+}
+
+void TimelineClockTransform::SetMapping(qint64 max_clock, qint64 scene_width, qint64 scene_offset)
+{
+    scene_offset_ = scene_offset;
+
+    if (max_clock == max_clock_ && scene_width == scene_width_)
+    {
+        return;
+    }
+
+    max_clock_   = max_clock;
+    scene_width_ = scene_width;
+
+    if (max_clock > 0 && scene_width > 0)
+    {
+        clock_to_scene_ = MakeRatio(scene_width, max_clock);
+        scene_to_clock_ = MakeRatio(max_clock, scene_width);
+    }
+    else
+    {
+        clock_to_scene_ = MakeRatio(0, 0);
+        scene_to_clock_ = MakeRatio(0, 0);
+    }
+}
+
+qint64 TimelineClockTransform::MaxClock() const
+{
+    return max_clock_;
+}
+
+qint64 TimelineClockTransform::SceneWidth() const
+{
+    return scene_width_;
+}
+
+qint64 TimelineClockTransform::SceneOffset() const
+{
+    return scene_offset_;
+}
+
+qint64 TimelineClockTransform::ClockToScene(qint64 clock) const
+{
+    return scene_offset_ + ScaleSigned(clock_to_scene_, clock, false);
+}
+
+qint64 TimelineClockTransform::SceneToClock(qint64 scene_x) const
+{
+    return ScaleSigned(scene_to_clock_, scene_x - scene_offset_, false);
+}
+
+qint64 TimelineClockTransform::SceneToFirstClock(qint64 scene_x) const
+{
+    return ScaleSigned(scene_to_clock_, scene_x - scene_offset_, true);
+}
+
+void TimelineClockTransform::ClockToScene(const qint64* clocks, qint64* scene_x, int count) const
+{
+    const Ratio  ratio  = clock_to_scene_;
+    const qint64 offset = scene_offset_;
+
+    for (int i = 0; i < count; i++)
+    {
+        scene_x[i] = offset + ScaleSigned(ratio, clocks[i], false);
+    }
+}
+
+void TimelineClockTransform::SceneToClock(const qint64* scene_x, qint64* clocks, int count) const
+{
+    const Ratio  ratio  = scene_to_clock_;
+    const qint64 offset = scene_offset_;
+
+    for (int i = 0; i < count; i++)
+    {
+        clocks[i] = ScaleSigned(ratio, scene_x[i] - offset, false);
+    }
+}
@@ -0,0 +1,118 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for a fixed-point clock to scene coordinate transform.
+//=============================================================================
+
+#ifndef QTCOMMON_CUSTOM_WIDGETS_TIMELINE_CLOCK_TRANSFORM_H_
+#define QTCOMMON_CUSTOM_WIDGETS_TIMELINE_CLOCK_TRANSFORM_H_
+
+#include <QtGlobal>
+
+/// Class that converts between timeline clocks and scene x-coordinates using integer math.
+///
+/// A clock maps to scene x = scene_offset + floor(clock * scene_width / max_clock), and a
+/// scene x-coordinate maps back to floor(x * max_clock / scene_width), truncating towards zero
+/// like the floating-point conversions TimelineView has always used. Each direction stores its
+/// ratio as an integer part plus a 64-bit fixed-point fraction, so a conversion is a multiply
+/// and a high-half multiply with a single exact correction step, rather than a floating-point
+/// divide. Results are exact for the full 64-bit clock range.
+///
+/// SceneToFirstClock() rounds up instead, giving the first clock drawn at a coordinate, which
+/// is what code splitting the scene into pixel columns needs. Round trips through it are exact
+/// in the direction that doesn't lose information: when the scene is wider than the clock range,
+/// ClockToScene() followed by SceneToFirstClock() returns the original clock; otherwise,
+/// SceneToFirstClock() followed by ClockToScene() returns the original x-coordinate.
+class TimelineClockTransform
+{
+public:
+    /// Constructor. The transform maps everything to 0 until a mapping is set.
+    TimelineClockTransform();
+
+    /// Destructor.
+    ~TimelineClockTransform();
+
+    /// Set the mapping between clocks and scene coordinates.
+    /// \param max_clock The clock value at the right edge of the scene.
+    /// \param scene_width The width of the scene, in pixels.
+    /// \param scene_offset The scene x-coordinate of clock 0.
+    void SetMapping(qint64 max_clock, qint64 scene_width, qint64 scene_offset = 0);
+
+    /// Get the clock value at the right edge of the scene.
+    /// \return The maximum clock.
+    qint64 MaxClock() const;
+
+    /// Get the width of the scene.
+    /// \return The scene width, in pixels.
+    qint64 SceneWidth() const;
+
+    /// Get the scene x-coordinate of clock 0.
+    /// \return The scene offset.
+    qint64 SceneOffset() const;
+
+    /// Convert a clock to a scene x-coordinate. Negative clocks are truncated towards clock 0.
+    /// \param clock The clock to convert.
+    /// \return The scene x-coordinate.
+    qint64 ClockToScene(qint64 clock) const;
+
+    /// Convert a scene x-coordinate to a clock, truncating towards clock 0.
+    /// \param scene_x The scene x-coordinate to convert.
+    /// \return The clock.
+    qint64 SceneToClock(qint64 scene_x) const;
+
+    /// Convert a scene x-coordinate to the first clock drawn at that coordinate.
+    /// \param scene_x The scene x-coordinate to convert.
+    /// \return The clock. This is SceneToClock() rounded up rather than down.
+    qint64 SceneToFirstClock(qint64 scene_x) const;
+
+    /// Convert an array of clocks to scene x-coordinates.
+    /// \param clocks The clocks to convert.
+    /// \param scene_x Receives the scene x-coordinates. May be the same array as clocks.
+    /// \param count The number of elements in each array.
+    void ClockToScene(const qint64* clocks, qint64* scene_x, int count) const;
+
+    /// Convert an array of scene x-coordinates to clocks.
+    /// \param scene_x The scene x-coordinates to convert.
+    /// \param clocks Receives the clocks. May be the same array as scene_x.
+    /// \param count The number of elements in each array.
+    void SceneToClock(const qint64* scene_x, qint64* clocks, int count) const;
+
+private:
+    /// A ratio numerator / divisor, split into an integer part and a fixed-point fraction.
+    struct Ratio
+    {
+        quint64 integer_part;  ///< numerator / divisor.
+        quint64 remainder;     ///< numerator % divisor.
+        quint64 fraction;      ///< floor(remainder * 2^64 / divisor).
+        quint64 divisor;       ///< The divisor, or 0 if the ratio is undefined.
+    };
+
+    /// Build a ratio.
+    /// \param numerator The ratio numerator.
+    /// \param divisor The ratio divisor.
+    /// \return The ratio.
+    static Ratio MakeRatio(quint64 numerator, quint64 divisor);
+
+    /// Multiply a value by a ratio.
+    /// \param ratio The ratio.
+    /// \param value The value to scale.
+    /// \param round_up If true, round the result up rather than down.
+    /// \return The scaled value.
+    static quint64 Scale(const Ratio& ratio, quint64 value, bool round_up);
+
+    /// Apply a ratio to a signed value, rounding towards zero for negative values.
+    /// \param ratio The ratio.
+    /// \param value The value to scale.
+    /// \param round_up If true, round the magnitude of the result up rather than down.
+    /// \return The scaled value.
+    static qint64 ScaleSigned(const Ratio& ratio, qint64 value, bool round_up);
+
+    qint64 max_clock_;       ///< The clock at the right edge of the scene.
+    qint64 scene_width_;     ///< The width of the scene, in pixels.
+    qint64 scene_offset_;    ///< The scene x-coordinate of clock 0.
+    Ratio  clock_to_scene_;  ///< scene_width_ / max_clock_.
+    Ratio  scene_to_clock_;  ///< max_clock_ / scene_width_.
+};
+
+#endif  // QTCOMMON_CUSTOM_WIDGETS_TIMELINE_CLOCK_TRANSFORM_H_
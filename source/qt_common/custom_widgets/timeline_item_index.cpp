@@ -0,0 +1,157 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of an interval index over timeline items.
+//=============================================================================
+
+#include "timeline_item_index.h"
+
+#include <algorithm>
+
+#include "timeline_view.h"
+
+/// Subtrees at or below this level are scanned linearly rather than traversed.
+static const int kLinearScanLevel = 3;
+
+TimelineItemIndex::TimelineItemIndex()
+    : root_level_(-1)
+{
+}
+
+TimelineItemIndex::~TimelineItemIndex()
+{
+}
+
+void TimelineItemIndex::Build(const QVector<TimelineItem>& items)
+{
+    entries_.resize(items.size());
+    for (int i = 0; i < items.size(); i++)
+    {
+        Entry& entry        = entries_[i];
+        entry.start_clock   = items[i].clock;
+        entry.end_clock     = items[i].clock + std::max<qint64>(items[i].duration, 0);
+        entry.max_end_clock = entry.end_clock;
+        entry.item_index    = i;
+    }
+
+    std::stable_sort(entries_.begin(), entries_.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.start_clock < rhs.start_clock; });
+
+    root_level_ = -1;
+
+    const qint64 count = entries_.size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Leaves are the even positions. Track the right-most node and its maximum, since the
+    // right-most subtree at each level may be incomplete.
+    qint64 last_index   = 0;
+    qint64 last_max_end = 0;
+    for (qint64 i = 0; i < count; i += 2)
+    {
+        last_index   = i;
+        last_max_end = entries_[i].end_clock;
+    }
+
+    // Compute the subtree maximums bottom-up, one level at a time.
+    int level = 1;
+    for (; (qint64(1) << level) <= count; level++)
+    {
+        const qint64 half_span  = qint64(1) << (level - 1);
+        const qint64 first_node = (half_span << 1) - 1;
+        const qint64 step       = half_span << 2;
+
+        for (qint64 i = first_node; i < count; i += step)
+        {
+            const qint64 left_max  = entries_[i - half_span].max_end_clock;
+            const qint64 right_max = ((i + half_span) < count) ? entries_[i + half_span].max_end_clock : last_max_end;
+
+            entries_[i].max_end_clock = std::max(entries_[i].end_clock, std::max(left_max, right_max));
+        }
+
+        last_index = ((last_index >> level) & 1) ? (last_index - half_span) : (last_index + half_span);
+        if (last_index < count && entries_[last_index].max_end_clock > last_max_end)
+        {
+            last_max_end = entries_[last_index].max_end_clock;
+        }
+    }
+
+    root_level_ = level - 1;
+}
+
+void TimelineItemIndex::Clear()
+{
+    entries_.clear();
+    root_level_ = -1;
+}
+
+int TimelineItemIndex::Size() const
+{
+    return entries_.size();
+}
+
+void TimelineItemIndex::Query(qint64 begin_clk, qint64 end_clk, QVector<int>& item_indices) const
+{
+    if (root_level_ < 0)
+    {
+        return;
+    }
+
+    /// A node waiting to be visited.
+    struct StackNode
+    {
+        int    level;         ///< The level of the node.
+        qint64 index;         ///< The position of the node in the entry array.
+        bool   left_visited;  ///< Whether the left subtree has already been queued.
+    };
+
+    const qint64 count = entries_.size();
+    StackNode    stack[64];
+    int          stack_size = 0;
+
+    stack[stack_size++] = {root_level_, (qint64(1) << root_level_) - 1, false};
+
+    while (stack_size > 0)
+    {
+        const StackNode node = stack[--stack_size];
+
+        if (node.level <= kLinearScanLevel)
+        {
+            // Small subtree, so scan its entries in order.
+            const qint64 first = (node.index >> node.level) << node.level;
+            const qint64 last  = std::min(first + (qint64(1) << (node.level + 1)) - 1, count);
+
+            for (qint64 i = first; i < last && entries_[i].start_clock <= end_clk; i++)
+            {
+                if (entries_[i].end_clock >= begin_clk)
+                {
+                    item_indices.append(entries_[i].item_index);
+                }
+            }
+        }
+        else if (node.left_visited == false)
+        {
+            // Revisit this node once the left subtree is done. The left child may be past the end
+            // of the array, in which case its own left descendants still need visiting.
+            const qint64 left_child = node.index - (qint64(1) << (node.level - 1));
+
+            stack[stack_size++] = {node.level, node.index, true};
+
+            if (left_child >= count || entries_[left_child].max_end_clock >= begin_clk)
+            {
+                stack[stack_size++] = {node.level - 1, left_child, false};
+            }
+        }
+        else if (node.index < count && entries_[node.index].start_clock <= end_clk)
+        {
+            if (entries_[node.index].end_clock >= begin_clk)
+            {
+                item_indices.append(entries_[node.index].item_index);
+            }
+
+            stack[stack_size++] = {node.level - 1, node.index + (qint64(1) << (node.level - 1)), false};
+        }
+    }
+}
@@ -0,0 +1,61 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for an interval index over timeline items.
+//=============================================================================
+
+#ifndef QTCOMMON_CUSTOM_WIDGETS_TIMELINE_ITEM_INDEX_H_
+#define QTCOMMON_CUSTOM_WIDGETS_TIMELINE_ITEM_INDEX_H_
+
+#include <QVector>
+
+struct TimelineItem;
+
+/// Class that finds the timeline items overlapping a clock range.
+///
+/// The items are kept in an array sorted by start clock, which is treated as an
+/// implicit balanced binary tree where each node also stores the maximum end clock
+/// of its subtree. A range query visits O(log n + k) entries, where k is the number
+/// of overlapping items.
+class TimelineItemIndex
+{
+public:
+    /// Constructor.
+    TimelineItemIndex();
+
+    /// Destructor.
+    ~TimelineItemIndex();
+
+    /// Rebuild the index from a list of timeline items.
+    /// \param items The items to index. Each item spans [clock, clock + duration].
+    void Build(const QVector<TimelineItem>& items);
+
+    /// Remove all entries from the index.
+    void Clear();
+
+    /// Get the number of indexed items.
+    /// \return The item count.
+    int Size() const;
+
+    /// Find all items overlapping a clock range.
+    /// \param begin_clk The start of the range (inclusive).
+    /// \param end_clk The end of the range (inclusive).
+    /// \param item_indices Receives the positions, in the list passed to Build(), of the overlapping items.
+    void Query(qint64 begin_clk, qint64 end_clk, QVector<int>& item_indices) const;
+
+private:
+    /// An indexed item.
+    struct Entry
+    {
+        qint64 start_clock;    ///< The start clock of the item.
+        qint64 end_clock;      ///< The end clock of the item.
+        qint64 max_end_clock;  ///< The maximum end clock within the subtree rooted at this entry.
+        int    item_index;     ///< The position of the item in the source list.
+    };
+
+    QVector<Entry> entries_;     ///< Entries sorted by start clock.
+    int            root_level_;  ///< The level of the root node, or -1 if the index is empty.
+};
+
+#endif  // QTCOMMON_CUSTOM_WIDGETS_TIMELINE_ITEM_INDEX_H_
@@ -0,0 +1,337 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of a level-of-detail timeline item.
+//=============================================================================
+
+#include "timeline_lod_item.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+
+#include "paint_profiler.h"
+
+/// The maximum number of buckets at the finest level of the pyramid. Zooming in
+/// further than this resolution draws the visible events directly.
+static const qint64 kMaxLevelZeroBuckets = 1 << 18;
+
+/// The number of distinct opacity steps used to show event density.
+static const int kDensityLevels = 8;
+
+/// A bucket containing no events.
+static const TimelineLodBucket kEmptyBucket = {std::numeric_limits<qint64>::max(), std::numeric_limits<qint64>::min(), 0};
+
+TimelineLodItem::TimelineLodItem()
+    : level_zero_bucket_clk_(1)
+    , scene_width_(0)
+    , max_clock_(0)
+    , height_(0)
+    , color_(0, 118, 215)
+{
+    // Needed so that paint() receives the exposed rect rather than the whole bounding rect.
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+}
+
+TimelineLodItem::~TimelineLodItem()
+{
+}
+
+void TimelineLodItem::SetEvents(const QVector<TimelineLodEvent>& events)
+{
+    events_.clear();
+    events_.reserve(events.size());
+
+    for (const TimelineLodEvent& event : events)
+    {
+        TimelineLodEvent sanitized_event;
+        sanitized_event.clock    = std::max<qint64>(event.clock, 0);
+        sanitized_event.duration = std::max<qint64>(event.duration, 0);
+        events_.append(sanitized_event);
+    }
+
+    std::sort(events_.begin(), events_.end(), [](const TimelineLodEvent& lhs, const TimelineLodEvent& rhs) { return lhs.clock < rhs.clock; });
+
+    event_prefix_max_end_.resize(events_.size());
+    qint64 max_end = std::numeric_limits<qint64>::min();
+    for (int i = 0; i < events_.size(); i++)
+    {
+        max_end                  = std::max(max_end, events_[i].clock + events_[i].duration);
+        event_prefix_max_end_[i] = max_end;
+    }
+
+    BuildLevels();
+
+    update();
+}
+
+void TimelineLodItem::Clear()
+{
+    SetEvents(QVector<TimelineLodEvent>());
+}
+
+void TimelineLodItem::BuildLevels()
+{
+    levels_.clear();
+    level_prefix_max_end_.clear();
+    level_zero_bucket_clk_ = 1;
+
+    if (events_.isEmpty())
+    {
+        return;
+    }
+
+    // Pick the finest bucket width that keeps the first level within its size limit.
+    const qint64 last_start_clock = events_.last().clock;
+    level_zero_bucket_clk_        = std::max<qint64>(1, (last_start_clock + kMaxLevelZeroBuckets) / kMaxLevelZeroBuckets);
+
+    QVector<TimelineLodBucket> level_zero(last_start_clock / level_zero_bucket_clk_ + 1, kEmptyBucket);
+    for (const TimelineLodEvent& event : events_)
+    {
+        TimelineLodBucket& bucket = level_zero[event.clock / level_zero_bucket_clk_];
+        bucket.min_clock          = std::min(bucket.min_clock, event.clock);
+        bucket.max_clock          = std::max(bucket.max_clock, event.clock + event.duration);
+        bucket.count++;
+    }
+    levels_.append(level_zero);
+
+    // Each coarser level merges pairs of buckets from the level below.
+    while (levels_.last().size() > 1)
+    {
+        const QVector<TimelineLodBucket>& finer_level = levels_.last();
+        QVector<TimelineLodBucket>        coarser_level((finer_level.size() + 1) / 2, kEmptyBucket);
+
+        for (int i = 0; i < finer_level.size(); i++)
+        {
+            TimelineLodBucket& bucket = coarser_level[i / 2];
+            bucket.min_clock          = std::min(bucket.min_clock, finer_level[i].min_clock);
+            bucket.max_clock          = std::max(bucket.max_clock, finer_level[i].max_clock);
+            bucket.count += finer_level[i].count;
+        }
+
+        levels_.append(coarser_level);
+    }
+
+    level_prefix_max_end_.resize(levels_.size());
+    for (int level = 0; level < levels_.size(); level++)
+    {
+        const QVector<TimelineLodBucket>& buckets    = levels_[level];
+        QVector<qint64>&                  prefix_max = level_prefix_max_end_[level];
+
+        prefix_max.resize(buckets.size());
+        qint64 max_end = std::numeric_limits<qint64>::min();
+        for (int i = 0; i < buckets.size(); i++)
+        {
+            max_end       = std::max(max_end, buckets[i].max_clock);
+            prefix_max[i] = max_end;
+        }
+    }
+}
+
+void TimelineLodItem::SetSceneMapping(int scene_width, qint64 max_clock)
+{
+    if (scene_width != scene_width_)
+    {
+        prepareGeometryChange();
+        scene_width_ = scene_width;
+    }
+
+    if (max_clock != max_clock_)
+    {
+        max_clock_ = max_clock;
+        update();
+    }
+
+    clock_transform_.SetMapping(max_clock_, scene_width_);
+}
+
+void TimelineLodItem::SetHeight(int height)
+{
+    if (height != height_)
+    {
+        prepareGeometryChange();
+        height_ = height;
+    }
+}
+
+void TimelineLodItem::SetColor(const QColor& color)
+{
+    color_ = color;
+    update();
+}
+
+int TimelineLodItem::EventCount() const
+{
+    return events_.size();
+}
+
+int TimelineLodItem::LevelCount() const
+{
+    return levels_.size();
+}
+
+QRectF TimelineLodItem::boundingRect() const
+{
+    return QRectF(0, 0, scene_width_, height_);
+}
+
+void TimelineLodItem::AccumulateSpan(int               first_column,
+                                     QVector<quint32>& column_density,
+                                     QVector<qint32>&  column_coverage,
+                                     qint64            min_clock,
+                                     qint64            max_clock,
+                                     quint32           count) const
+{
+    const int column_count = column_density.size();
+    qint64    start_column = clock_transform_.ClockToScene(min_clock) - first_column;
+    qint64    end_column   = clock_transform_.ClockToScene(max_clock) - first_column;
+
+    if (end_column < 0 || start_column >= column_count)
+    {
+        return;
+    }
+
+    if (start_column >= 0)
+    {
+        column_density[(int)start_column] += count;
+    }
+
+    start_column = std::max<qint64>(start_column, 0);
+    end_column   = std::min<qint64>(end_column, column_count - 1);
+
+    column_coverage[(int)start_column]++;
+    column_coverage[(int)end_column + 1]--;
+}
+
+void TimelineLodItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    QTCOMMON_PROFILE_SCOPE("TimelineLodItem::paint");
+
+    Q_UNUSED(widget);
+
+    if (events_.isEmpty() || scene_width_ <= 0 || max_clock_ <= 0 || height_ <= 0)
+    {
+        return;
+    }
+
+    const QRectF exposed_rect = option->exposedRect.intersected(boundingRect());
+    if (exposed_rect.isEmpty())
+    {
+        return;
+    }
+
+    // Everything below is proportional to the number of exposed pixel columns.
+    const int first_column = std::max(0, (int)std::floor(exposed_rect.left()));
+    const int last_column  = std::min(scene_width_ - 1, (int)std::ceil(exposed_rect.right()));
+    if (last_column < first_column)
+    {
+        return;
+    }
+
+    const int    column_count     = last_column - first_column + 1;
+    const double clocks_per_pixel = (double)max_clock_ / (double)scene_width_;
+    const qint64 begin_clk        = clock_transform_.SceneToFirstClock(first_column);
+    const qint64 end_clk          = clock_transform_.SceneToFirstClock(last_column + 1);
+
+    QVector<quint32> column_density(column_count, 0);
+    QVector<qint32>  column_coverage(column_count + 1, 0);
+
+    if (level_zero_bucket_clk_ > clocks_per_pixel)
+    {
+        // Zoomed in further than the finest level, so use the visible events directly.
+        const auto first_event =
+            std::lower_bound(events_.cbegin(), events_.cend(), begin_clk, [](const TimelineLodEvent& event, qint64 clock) { return event.clock < clock; });
+        int index = first_event - events_.cbegin();
+
+        // Events starting to the left of the exposed area may still extend into it.
+        if (index > 0 && event_prefix_max_end_[index - 1] >= begin_clk)
+        {
+            AccumulateSpan(first_column, column_density, column_coverage, begin_clk, event_prefix_max_end_[index - 1], 0);
+        }
+
+        for (; index < events_.size() && events_[index].clock <= end_clk; index++)
+        {
+            AccumulateSpan(first_column, column_density, column_coverage, events_[index].clock, events_[index].clock + events_[index].duration, 1);
+        }
+    }
+    else
+    {
+        // Use the coarsest level where a single pixel still covers at least one bucket.
+        int    level      = 0;
+        qint64 bucket_clk = level_zero_bucket_clk_;
+        while ((level + 1) < levels_.size() && (bucket_clk * 2) <= clocks_per_pixel)
+        {
+            level++;
+            bucket_clk *= 2;
+        }
+
+        const QVector<TimelineLodBucket>& buckets      = levels_[level];
+        const QVector<qint64>&            prefix_max   = level_prefix_max_end_[level];
+        const qint64                      first_bucket = begin_clk / bucket_clk;
+        const qint64                      last_bucket  = std::min<qint64>(end_clk / bucket_clk, buckets.size() - 1);
+
+        // Events from buckets to the left of the exposed area may still extend into it, including when the
+        // exposed area starts after the last bucket.
+        const qint64 carry_bucket = std::min<qint64>(first_bucket, buckets.size());
+        if (carry_bucket > 0 && prefix_max[carry_bucket - 1] >= begin_clk)
+        {
+            AccumulateSpan(first_column, column_density, column_coverage, begin_clk, prefix_max[carry_bucket - 1], 0);
+        }
+
+        for (qint64 i = first_bucket; i <= last_bucket; i++)
+        {
+            const TimelineLodBucket& bucket = buckets[i];
+            if (bucket.count > 0)
+            {
+                AccumulateSpan(first_column, column_density, column_coverage, bucket.min_clock, bucket.max_clock, bucket.count);
+            }
+        }
+    }
+
+    quint32 max_density = 1;
+    for (quint32 density : column_density)
+    {
+        max_density = std::max(max_density, density);
+    }
+    const double log_max_density = std::log1p((double)max_density);
+
+    painter->save();
+    painter->setPen(Qt::NoPen);
+
+    // Merge neighboring columns with the same opacity into a single rectangle.
+    int run_start    = 0;
+    int run_level    = 0;
+    int coverage_sum = 0;
+    for (int column = 0; column <= column_count; column++)
+    {
+        int density_level = 0;
+        if (column < column_count)
+        {
+            coverage_sum += column_coverage[column];
+            if (coverage_sum > 0)
+            {
+                const double density_ratio = std::log1p((double)column_density[column]) / log_max_density;
+                density_level               = 1 + (int)std::lround(density_ratio * (kDensityLevels - 1));
+            }
+        }
+
+        if (density_level != run_level || column == column_count)
+        {
+            if (run_level > 0)
+            {
+                QColor run_color = color_;
+                run_color.setAlphaF(color_.alphaF() * run_level / kDensityLevels);
+                painter->fillRect(QRectF(first_column + run_start, 0, column - run_start, height_), run_color);
+            }
+
+            run_start = column;
+            run_level = density_level;
+        }
+    }
+
+    painter->restore();
+}
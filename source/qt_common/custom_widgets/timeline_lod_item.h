@@ -0,0 +1,116 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for a level-of-detail timeline item.
+//=============================================================================
+
+#ifndef QTCOMMON_CUSTOM_WIDGETS_TIMELINE_LOD_ITEM_H_
+#define QTCOMMON_CUSTOM_WIDGETS_TIMELINE_LOD_ITEM_H_
+
+#include <QColor>
+#include <QGraphicsItem>
+#include <QVector>
+
+#include "timeline_clock_transform.h"
+
+/// An event summarized by the level-of-detail item.
+struct TimelineLodEvent
+{
+    qint64 clock;     ///< The start clock of the event.
+    qint64 duration;  ///< The duration of the event, in clocks.
+};
+
+/// A single bucket in the level-of-detail pyramid.
+struct TimelineLodBucket
+{
+    qint64  min_clock;  ///< The earliest start clock of the events in this bucket.
+    qint64  max_clock;  ///< The latest end clock of the events in this bucket.
+    quint32 count;      ///< The number of events that start in this bucket.
+};
+
+/// Class that draws a large number of timeline events through a single graphics item.
+///
+/// Events are bucketed by their start clock into a min/max/count pyramid, where each
+/// level covers twice the clock range per bucket of the level below it. When painting,
+/// the level whose bucket width best matches the clocks covered by one pixel is used,
+/// so the cost of a paint depends on the exposed width rather than the event count.
+class TimelineLodItem : public QGraphicsItem
+{
+public:
+    /// Constructor.
+    TimelineLodItem();
+
+    /// Virtual destructor.
+    virtual ~TimelineLodItem();
+
+    /// Set the events to be drawn, and rebuild the level-of-detail pyramid.
+    /// \param events The events to draw. The events do not need to be sorted.
+    void SetEvents(const QVector<TimelineLodEvent>& events);
+
+    /// Remove all events.
+    void Clear();
+
+    /// Set how clocks map to scene coordinates. Should match the owning timeline's ruler.
+    /// \param scene_width The width of the scene, in pixels.
+    /// \param max_clock The clock value at the right edge of the scene.
+    void SetSceneMapping(int scene_width, qint64 max_clock);
+
+    /// Set the height of the item.
+    /// \param height The new height, in pixels.
+    void SetHeight(int height);
+
+    /// Set the color used to draw the events. Denser regions are drawn more opaque.
+    /// \param color The event color.
+    void SetColor(const QColor& color);
+
+    /// Get the number of events summarized by this item.
+    /// \return The event count.
+    int EventCount() const;
+
+    /// Get the number of levels in the level-of-detail pyramid.
+    /// \return The level count.
+    int LevelCount() const;
+
+    /// Overridden implementation of Qt's bounding rect for this item.
+    /// \return The item's bounding rectangle.
+    virtual QRectF boundingRect() const Q_DECL_OVERRIDE;
+
+    /// Implementation of Qt's paint for this item.
+    /// \param painter The painter object to use.
+    /// \param option Provides style options for the item, such as its state, exposed area and its level-of-detail hints.
+    /// \param widget Points to the widget that is being painted on if specified.
+    virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) Q_DECL_OVERRIDE;
+
+private:
+    /// Build the bucket pyramid from the sorted event list.
+    void BuildLevels();
+
+    /// Accumulate events or buckets into per-column density and coverage counts.
+    /// \param first_column The left-most exposed pixel column.
+    /// \param column_density The number of events starting in each column.
+    /// \param column_coverage The number of events or buckets overlapping each column, as a difference array.
+    /// \param min_clock The start clock of the event or bucket.
+    /// \param max_clock The end clock of the event or bucket.
+    /// \param count The number of events represented.
+    void AccumulateSpan(int               first_column,
+                        QVector<quint32>& column_density,
+                        QVector<qint32>&  column_coverage,
+                        qint64            min_clock,
+                        qint64            max_clock,
+                        quint32           count) const;
+
+    QVector<TimelineLodEvent>           events_;                 ///< Events sorted by start clock.
+    QVector<qint64>                     event_prefix_max_end_;   ///< Running maximum of the event end clocks.
+    QVector<QVector<TimelineLodBucket>> levels_;                 ///< The bucket pyramid, finest level first.
+    QVector<QVector<qint64>>            level_prefix_max_end_;   ///< Running maximum of the bucket end clocks, per level.
+    qint64                              level_zero_bucket_clk_;  ///< The number of clocks covered by a bucket at level zero.
+
+    int                    scene_width_;      ///< The width of the scene, in pixels.
+    qint64                 max_clock_;        ///< The clock at the right edge of the scene.
+    TimelineClockTransform clock_transform_;  ///< Maps clocks to item x-coordinates.
+    int                    height_;           ///< The height of the item.
+    QColor                 color_;            ///< The event color.
+};
+
+#endif  // QTCOMMON_CUSTOM_WIDGETS_TIMELINE_LOD_ITEM_H_
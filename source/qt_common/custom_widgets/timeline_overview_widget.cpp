@@ -0,0 +1,417 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of an overview strip showing the whole range of a timeline.
+//=============================================================================
+
+#include "timeline_overview_widget.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+
+#include <QMouseEvent>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPainter>
+#include <QRunnable>
+#include <QThreadPool>
+
+#include "paint_profiler.h"
+#include "qt_util.h"
+#include "timeline_clock_transform.h"
+#include "timeline_view.h"
+
+/// The number of bins in the density histogram.
+static const int kHistogramBinCount = 4096;
+
+/// The number of events added to the histogram per lock of the shared state.
+static const int kHistogramChunkSize = 65536;
+
+/// The number of events processed between updates of the displayed histogram.
+static const int kHistogramPublishInterval = 1 << 20;
+
+/// The default size of the widget.
+static const int kDefaultWidth  = 350;
+static const int kDefaultHeight = 24;
+
+struct TimelineOverviewWidget::HistogramState
+{
+    HistogramState()
+        : coverage_delta(kHistogramBinCount + 1, 0)
+        , max_clock(0)
+        , generation(0)
+    {
+    }
+
+    QMutex               mutex;           ///< Guards coverage_delta and max_clock, and changes to generation.
+    QVector<qint64>      coverage_delta;  ///< The change in overlapping event count at each bin.
+    qint64               max_clock;       ///< The clock value at the end of the last bin.
+    std::atomic<quint64> generation;      ///< Incremented whenever the event set is replaced.
+};
+
+/// Runs a function on a worker thread.
+class TimelineOverviewTask : public QRunnable
+{
+public:
+    /// Constructor.
+    /// \param function The function to run.
+    explicit TimelineOverviewTask(const std::function<void()>& function)
+        : function_(function)
+    {
+    }
+
+    /// Run the function.
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        function_();
+    }
+
+private:
+    std::function<void()> function_;  ///< The function to run.
+};
+
+TimelineOverviewWidget::TimelineOverviewWidget(QWidget* parent)
+    : QWidget(parent)
+    , histogram_state_(std::make_shared<HistogramState>())
+    , thread_pool_(new QThreadPool(this))
+    , bin_counts_(kHistogramBinCount, 0)
+    , max_clock_(0)
+    , density_color_(0, 118, 215)
+    , viewable_start_clock_(0)
+    , viewable_end_clock_(0)
+    , is_dragging_(false)
+    , drag_offset_clock_(0)
+{
+    // Tasks for one event set must be applied in order, and one thread is plenty for a histogram.
+    thread_pool_->setMaxThreadCount(1);
+
+    connect(&QtCommon::QtUtils::ColorTheme::Get(), &QtCommon::QtUtils::ColorTheme::ColorThemeUpdated, this, &TimelineOverviewWidget::RebuildImage);
+}
+
+TimelineOverviewWidget::~TimelineOverviewWidget()
+{
+    disconnect(&QtCommon::QtUtils::ColorTheme::Get(), &QtCommon::QtUtils::ColorTheme::ColorThemeUpdated, this, &TimelineOverviewWidget::RebuildImage);
+
+    // Tasks post their progress back to this widget, so none may still be running once it's gone.
+    histogram_state_->generation++;
+    thread_pool_->clear();
+    thread_pool_->waitForDone();
+}
+
+void TimelineOverviewWidget::SetTimelineView(TimelineView* timeline_view)
+{
+    if (timeline_view_ != nullptr)
+    {
+        disconnect(timeline_view_, &TimelineView::ViewableRangeChanged, this, &TimelineOverviewWidget::ViewableRangeChanged);
+    }
+
+    timeline_view_ = timeline_view;
+
+    if (timeline_view_ != nullptr)
+    {
+        connect(timeline_view_, &TimelineView::ViewableRangeChanged, this, &TimelineOverviewWidget::ViewableRangeChanged);
+        ViewableRangeChanged(timeline_view_->ViewableStartClk(), timeline_view_->ViewableEndClk());
+    }
+    else
+    {
+        update();
+    }
+}
+
+void TimelineOverviewWidget::ViewableRangeChanged(qint64 start_clk, qint64 end_clk)
+{
+    viewable_start_clock_ = start_clk;
+    viewable_end_clock_   = end_clk;
+    update();
+}
+
+void TimelineOverviewWidget::SetEvents(const QVector<TimelineLodEvent>& events, qint64 max_clock)
+{
+    // Stop any work on the previous event set before resetting the histogram. The generation changes
+    // under the lock, so a task that still holds the previous generation can't add to the new histogram.
+    thread_pool_->clear();
+
+    {
+        QMutexLocker locker(&histogram_state_->mutex);
+        histogram_state_->generation++;
+        histogram_state_->coverage_delta.fill(0);
+        histogram_state_->max_clock = max_clock;
+    }
+
+    max_clock_ = max_clock;
+    bin_counts_.fill(0);
+
+    StartHistogramTask(events);
+    RebuildImage();
+}
+
+void TimelineOverviewWidget::AppendEvents(const QVector<TimelineLodEvent>& events)
+{
+    StartHistogramTask(events);
+}
+
+void TimelineOverviewWidget::Clear()
+{
+    SetEvents(QVector<TimelineLodEvent>(), 0);
+}
+
+void TimelineOverviewWidget::SetDensityColor(const QColor& color)
+{
+    density_color_ = color;
+    RebuildImage();
+}
+
+void TimelineOverviewWidget::StartHistogramTask(const QVector<TimelineLodEvent>& events)
+{
+    if (events.isEmpty() || max_clock_ <= 0)
+    {
+        return;
+    }
+
+    const std::shared_ptr<HistogramState> state      = histogram_state_;
+    const quint64                         generation = state->generation;
+    const qint64                          max_clock  = max_clock_;
+
+    thread_pool_->start(new TimelineOverviewTask([this, state, events, generation, max_clock]() {
+        TimelineClockTransform clock_to_bin;
+        clock_to_bin.SetMapping(max_clock, kHistogramBinCount);
+
+        int unpublished_count = 0;
+        for (int chunk_start = 0; chunk_start < events.size(); chunk_start += kHistogramChunkSize)
+        {
+            if (state->generation != generation)
+            {
+                return;
+            }
+
+            const int chunk_end = std::min(chunk_start + kHistogramChunkSize, (int)events.size());
+
+            {
+                QMutexLocker locker(&state->mutex);
+
+                // The event set may have been replaced while waiting for the lock.
+                if (state->generation != generation)
+                {
+                    return;
+                }
+
+                // Each event adds one to every bin it overlaps, recorded as a difference array.
+                for (int i = chunk_start; i < chunk_end; i++)
+                {
+                    const TimelineLodEvent& event = events[i];
+
+                    const qint64 first_bin = qBound<qint64>(0, clock_to_bin.ClockToScene(event.clock), kHistogramBinCount - 1);
+                    const qint64 last_bin  = qBound<qint64>(first_bin, clock_to_bin.ClockToScene(event.clock + std::max<qint64>(event.duration, 0)), kHistogramBinCount - 1);
+
+                    state->coverage_delta[(int)first_bin]++;
+                    state->coverage_delta[(int)last_bin + 1]--;
+                }
+            }
+
+            unpublished_count += chunk_end - chunk_start;
+            if (unpublished_count >= kHistogramPublishInterval || chunk_end == events.size())
+            {
+                if (state->generation != generation)
+                {
+                    return;
+                }
+
+                unpublished_count = 0;
+                QMetaObject::invokeMethod(
+                    this, [this, generation]() { HistogramUpdated(generation); }, Qt::QueuedConnection);
+            }
+        }
+    }));
+}
+
+void TimelineOverviewWidget::HistogramUpdated(quint64 generation)
+{
+    if (generation != histogram_state_->generation)
+    {
+        return;
+    }
+
+    QVector<qint64> coverage_delta;
+    {
+        QMutexLocker locker(&histogram_state_->mutex);
+        coverage_delta = histogram_state_->coverage_delta;
+    }
+
+    qint64 coverage = 0;
+    for (int i = 0; i < kHistogramBinCount; i++)
+    {
+        coverage += coverage_delta[i];
+        bin_counts_[i] = std::max<qint64>(coverage, 0);
+    }
+
+    RebuildImage();
+}
+
+void TimelineOverviewWidget::RebuildImage()
+{
+    const qreal device_pixel_ratio = devicePixelRatioF();
+    const QSize image_size         = size() * device_pixel_ratio;
+
+    if (image_size.isEmpty())
+    {
+        heatmap_image_ = QImage();
+        return;
+    }
+
+    heatmap_image_ = QImage(image_size, QImage::Format_ARGB32_Premultiplied);
+    heatmap_image_.fill(QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors().graphics_scene_background_color);
+
+    quint64 max_count = 1;
+    for (quint64 count : bin_counts_)
+    {
+        max_count = std::max(max_count, count);
+    }
+    const double log_max_count = std::log1p((double)max_count);
+
+    QPainter painter(&heatmap_image_);
+    painter.setPen(Qt::NoPen);
+
+    // Each pixel column shows the densest bin it covers.
+    const int image_width = image_size.width();
+    for (int column = 0; column < image_width; column++)
+    {
+        const int first_bin = (int)(((qint64)column * kHistogramBinCount) / image_width);
+        const int end_bin   = std::max(first_bin + 1, (int)(((qint64)(column + 1) * kHistogramBinCount) / image_width));
+
+        quint64 count = 0;
+        for (int bin = first_bin; bin < end_bin; bin++)
+        {
+            count = std::max(count, bin_counts_[bin]);
+        }
+
+        if (count > 0)
+        {
+            QColor column_color = density_color_;
+            column_color.setAlphaF(density_color_.alphaF() * (0.15 + (0.85 * std::log1p((double)count) / log_max_count)));
+            painter.fillRect(QRect(column, 0, 1, image_size.height()), column_color);
+        }
+    }
+
+    painter.end();
+
+    heatmap_image_.setDevicePixelRatio(device_pixel_ratio);
+
+    update();
+}
+
+double TimelineOverviewWidget::ClockToX(qint64 clock) const
+{
+    if (max_clock_ <= 0)
+    {
+        return 0;
+    }
+
+    return ((double)clock * width()) / (double)max_clock_;
+}
+
+qint64 TimelineOverviewWidget::XToClock(double x) const
+{
+    if (width() <= 0)
+    {
+        return 0;
+    }
+
+    return (qint64)((qBound(0.0, x, (double)width()) * (double)max_clock_) / width());
+}
+
+QSize TimelineOverviewWidget::sizeHint() const
+{
+    return QSize(kDefaultWidth, kDefaultHeight);
+}
+
+void TimelineOverviewWidget::paintEvent(QPaintEvent* paint_event)
+{
+    QTCOMMON_PROFILE_SCOPE("TimelineOverviewWidget::paintEvent");
+
+    Q_UNUSED(paint_event);
+
+    QPainter painter(this);
+
+    if (heatmap_image_.isNull() == false)
+    {
+        painter.drawImage(0, 0, heatmap_image_);
+    }
+
+    // Draw the range visible in the timeline on top of the heatmap.
+    if (timeline_view_ != nullptr && max_clock_ > 0 && viewable_end_clock_ > viewable_start_clock_)
+    {
+        const double left  = ClockToX(viewable_start_clock_);
+        const double right = std::max(ClockToX(viewable_end_clock_), left + 2);
+
+        const DefaultThemeColors& theme_colors = QtCommon::QtUtils::ColorTheme::Get().GetCurrentThemeColors();
+
+        QColor fill_color = theme_colors.ruler_marker_color;
+        fill_color.setAlpha(40);
+
+        QPen pen(theme_colors.ruler_edge_color);
+        pen.setCosmetic(true);
+
+        painter.setPen(pen);
+        painter.setBrush(fill_color);
+        painter.drawRect(QRectF(left, 0, right - left, height() - 1));
+    }
+}
+
+void TimelineOverviewWidget::resizeEvent(QResizeEvent* resize_event)
+{
+    QTCOMMON_PROFILE_SCOPE("TimelineOverviewWidget::resizeEvent");
+
+    QWidget::resizeEvent(resize_event);
+
+    RebuildImage();
+}
+
+void TimelineOverviewWidget::mousePressEvent(QMouseEvent* mouse_event)
+{
+    QWidget::mousePressEvent(mouse_event);
+
+    if (mouse_event->button() != Qt::LeftButton || timeline_view_ == nullptr || max_clock_ <= 0)
+    {
+        return;
+    }
+
+    const qint64 clock        = XToClock(mouse_event->pos().x());
+    const qint64 center_clock = (viewable_start_clock_ + viewable_end_clock_) / 2;
+
+    // Grabbing the visible range keeps it under the mouse; clicking elsewhere centers on the click.
+    if (clock >= viewable_start_clock_ && clock <= viewable_end_clock_)
+    {
+        drag_offset_clock_ = clock - center_clock;
+    }
+    else
+    {
+        drag_offset_clock_ = 0;
+    }
+
+    is_dragging_ = true;
+
+    timeline_view_->CenterOnClock(clock - drag_offset_clock_);
+}
+
+void TimelineOverviewWidget::mouseMoveEvent(QMouseEvent* mouse_event)
+{
+    QWidget::mouseMoveEvent(mouse_event);
+
+    if (is_dragging_ == true && timeline_view_ != nullptr)
+    {
+        timeline_view_->CenterOnClock(XToClock(mouse_event->pos().x()) - drag_offset_clock_);
+    }
+}
+
+void TimelineOverviewWidget::mouseReleaseEvent(QMouseEvent* mouse_event)
+{
+    QWidget::mouseReleaseEvent(mouse_event);
+
+    if (mouse_event->button() == Qt::LeftButton)
+    {
+        is_dragging_ = false;
+    }
+}
@@ -0,0 +1,131 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for an overview strip showing the whole range of a timeline.
+//=============================================================================
+
+#ifndef QTCOMMON_CUSTOM_WIDGETS_TIMELINE_OVERVIEW_WIDGET_H_
+#define QTCOMMON_CUSTOM_WIDGETS_TIMELINE_OVERVIEW_WIDGET_H_
+
+#include <memory>
+
+#include <QImage>
+#include <QPointer>
+#include <QVector>
+#include <QWidget>
+
+#include "timeline_lod_item.h"
+
+class QThreadPool;
+class TimelineView;
+
+/// Class that shows the full clock range of a timeline as an event density heatmap,
+/// with the timeline's visible range drawn on top. Clicking or dragging in the overview
+/// scrolls the timeline.
+///
+/// The density histogram is built on a worker thread, in chunks, and drawn as a single
+/// cached image, so repainting never visits the events.
+class TimelineOverviewWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /// Explicit constructor
+    /// \param parent The parent of this widget
+    explicit TimelineOverviewWidget(QWidget* parent = nullptr);
+
+    /// Destructor. Waits for any histogram work in progress.
+    virtual ~TimelineOverviewWidget();
+
+    /// Set the timeline this overview follows and navigates.
+    /// \param timeline_view The timeline view, or nullptr to detach.
+    void SetTimelineView(TimelineView* timeline_view);
+
+    /// Replace the events shown in the overview. The histogram is rebuilt in the background.
+    /// \param events The events.
+    /// \param max_clock The clock value at the right edge of the overview.
+    void SetEvents(const QVector<TimelineLodEvent>& events, qint64 max_clock);
+
+    /// Add more events to the overview, keeping the current clock range.
+    /// \param events The events to add.
+    void AppendEvents(const QVector<TimelineLodEvent>& events);
+
+    /// Remove all events from the overview.
+    void Clear();
+
+    /// Set the color used to draw event density. Denser regions are drawn more opaque.
+    /// \param color The density color.
+    void SetDensityColor(const QColor& color);
+
+    /// Provide a sizeHint for this widget. The overview stretches to the width given by
+    /// the layout, so this is only a default size.
+    /// \return The preferred size of the widget.
+    virtual QSize sizeHint() const Q_DECL_OVERRIDE;
+
+protected:
+    /// Paint the cached heatmap and the visible range.
+    /// \param paint_event The paint event.
+    virtual void paintEvent(QPaintEvent* paint_event) Q_DECL_OVERRIDE;
+
+    /// Rebuild the cached heatmap at the new size.
+    /// \param resize_event The resize event.
+    virtual void resizeEvent(QResizeEvent* resize_event) Q_DECL_OVERRIDE;
+
+    /// Start navigating the timeline.
+    /// \param mouse_event The mouse event.
+    virtual void mousePressEvent(QMouseEvent* mouse_event) Q_DECL_OVERRIDE;
+
+    /// Continue navigating the timeline while dragging.
+    /// \param mouse_event The mouse event.
+    virtual void mouseMoveEvent(QMouseEvent* mouse_event) Q_DECL_OVERRIDE;
+
+    /// Stop navigating the timeline.
+    /// \param mouse_event The mouse event.
+    virtual void mouseReleaseEvent(QMouseEvent* mouse_event) Q_DECL_OVERRIDE;
+
+private slots:
+    /// Repaint the visible range.
+    /// \param start_clk The viewable start clock.
+    /// \param end_clk The viewable end clock.
+    void ViewableRangeChanged(qint64 start_clk, qint64 end_clk);
+
+    /// Rebuild the cached heatmap.
+    void RebuildImage();
+
+private:
+    /// The histogram shared with the worker thread.
+    struct HistogramState;
+
+    /// Copy the latest histogram from the worker, if it belongs to the current event set.
+    /// \param generation The event set the histogram was built for.
+    void HistogramUpdated(quint64 generation);
+
+    /// Queue histogram work for a set of events.
+    /// \param events The events to add to the histogram.
+    void StartHistogramTask(const QVector<TimelineLodEvent>& events);
+
+    /// Convert a clock to a widget x-coordinate.
+    /// \param clock The clock.
+    /// \return The x-coordinate.
+    double ClockToX(qint64 clock) const;
+
+    /// Convert a widget x-coordinate to a clock.
+    /// \param x The x-coordinate.
+    /// \return The clock.
+    qint64 XToClock(double x) const;
+
+    std::shared_ptr<HistogramState> histogram_state_;       ///< Histogram data shared with the worker thread
+    QThreadPool*                    thread_pool_;           ///< Single worker thread that builds the histogram
+    QVector<quint64>                bin_counts_;            ///< The latest histogram, as overlapping events per bin
+    qint64                          max_clock_;             ///< The clock value at the right edge of the overview
+    QImage                          heatmap_image_;         ///< The cached heatmap
+    QColor                          density_color_;         ///< The color used to draw event density
+    QPointer<TimelineView>          timeline_view_;         ///< The timeline this overview follows
+    qint64                          viewable_start_clock_;  ///< The timeline's viewable start clock
+    qint64                          viewable_end_clock_;    ///< The timeline's viewable end clock
+    bool                            is_dragging_;           ///< Whether the user is dragging the visible range
+    qint64                          drag_offset_clock_;     ///< The clock offset from the center of the visible range to the mouse
+};
+
+#endif  // QTCOMMON_CUSTOM_WIDGETS_TIMELINE_OVERVIEW_WIDGET_H_
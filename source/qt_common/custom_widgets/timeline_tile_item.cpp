@@ -0,0 +1,280 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of a timeline item rendered in tiles on worker threads.
+//=============================================================================
+
+#include "timeline_tile_item.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QPainter>
+#include <QRunnable>
+#include <QStyleOptionGraphicsItem>
+#include <QThreadPool>
+#include <QWidget>
+
+#include "paint_profiler.h"
+#include "qt_util.h"
+
+/// The width of a tile, in pixels.
+static const int kTileWidth = 256;
+
+/// The memory budget for rendered tiles, in KiB.
+static const int kTileCacheSizeKiB = 256 * 1024;
+
+/// The number of tiles either side of the exposed area to render ahead of time.
+static const int kPrefetchTileCount = 1;
+
+/// Renders a single tile on a worker thread and hands the result back to the item.
+class TimelineTileTask : public QRunnable
+{
+public:
+    /// Constructor.
+    /// \param render_function The function that draws the tile.
+    /// \param request The area of the tile.
+    /// \param device_pixel_ratio The device pixel ratio to render at.
+    /// \param deliver Called on the worker thread with the rendered image.
+    TimelineTileTask(const TimelineTileItem::RenderFunction&   render_function,
+                     const TimelineTileRequest&                request,
+                     qreal                                     device_pixel_ratio,
+                     const std::function<void(const QImage&)>& deliver)
+        : render_function_(render_function)
+        , request_(request)
+        , device_pixel_ratio_(device_pixel_ratio)
+        , deliver_(deliver)
+    {
+    }
+
+    /// Render the tile.
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        QTCOMMON_PROFILE_SCOPE("TimelineTileItem::RenderTile");
+
+        const QSize image_size((int)std::ceil(request_.tile_rect.width() * device_pixel_ratio_), (int)std::ceil(request_.tile_rect.height() * device_pixel_ratio_));
+
+        QImage image(image_size, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(device_pixel_ratio_);
+        image.fill(Qt::transparent);
+
+        QPainter painter(&image);
+        painter.translate(-request_.tile_rect.topLeft());
+        render_function_(&painter, request_);
+        painter.end();
+
+        deliver_(image);
+    }
+
+private:
+    TimelineTileItem::RenderFunction   render_function_;     ///< Draws the content of the tile.
+    TimelineTileRequest                request_;             ///< The area of the tile.
+    qreal                              device_pixel_ratio_;  ///< The device pixel ratio to render at.
+    std::function<void(const QImage&)> deliver_;             ///< Hands the rendered image back.
+};
+
+TimelineTileItem::TimelineTileItem(QGraphicsItem* parent)
+    : QGraphicsObject(parent)
+    , thread_pool_(new QThreadPool(this))
+    , tile_cache_(kTileCacheSizeKiB)
+    , generation_(0)
+    , scene_width_(0)
+    , max_clock_(0)
+    , height_(0)
+    , device_pixel_ratio_(1.0)
+    , theme_generation_(QtCommon::QtUtils::ColorTheme::Get().GetThemeGeneration())
+    , placeholder_color_(128, 128, 128, 32)
+{
+    // Needed so that paint() receives the exposed rect rather than the whole bounding rect.
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+}
+
+TimelineTileItem::~TimelineTileItem()
+{
+    // Tasks post their results back to this item, so none may still be running once it's gone.
+    thread_pool_->clear();
+    thread_pool_->waitForDone();
+}
+
+void TimelineTileItem::SetRenderFunction(const RenderFunction& render_function)
+{
+    render_function_ = render_function;
+    InvalidateTiles();
+}
+
+void TimelineTileItem::InvalidateTiles()
+{
+    ResetTiles();
+    update();
+}
+
+void TimelineTileItem::ResetTiles()
+{
+    thread_pool_->clear();
+    pending_tiles_.clear();
+    tile_cache_.clear();
+    generation_++;
+}
+
+void TimelineTileItem::SetSceneMapping(int scene_width, qint64 max_clock)
+{
+    if (scene_width != scene_width_)
+    {
+        prepareGeometryChange();
+        scene_width_ = scene_width;
+
+        // Tiles for the previous zoom level are kept in the cache, but any still queued
+        // are no longer useful.
+        thread_pool_->clear();
+        pending_tiles_.clear();
+    }
+
+    if (max_clock != max_clock_)
+    {
+        max_clock_ = max_clock;
+        ResetTiles();
+        update();
+    }
+
+    clock_transform_.SetMapping(max_clock_, scene_width_);
+}
+
+void TimelineTileItem::SetHeight(int height)
+{
+    if (height != height_)
+    {
+        prepareGeometryChange();
+        height_ = height;
+        ResetTiles();
+    }
+}
+
+void TimelineTileItem::SetPlaceholderColor(const QColor& color)
+{
+    placeholder_color_ = color;
+    update();
+}
+
+void TimelineTileItem::SetMaxThreadCount(int thread_count)
+{
+    thread_pool_->setMaxThreadCount(std::max(thread_count, 1));
+}
+
+int TimelineTileItem::PendingTileCount() const
+{
+    return pending_tiles_.size();
+}
+
+QRectF TimelineTileItem::boundingRect() const
+{
+    return QRectF(0, 0, scene_width_, height_);
+}
+
+void TimelineTileItem::RequestTile(int tile_index)
+{
+    const TileKey key(scene_width_, tile_index);
+
+    if (tile_cache_.contains(key) || pending_tiles_.contains(key))
+    {
+        return;
+    }
+
+    TimelineTileRequest request;
+    request.tile_rect   = QRect(tile_index * kTileWidth, 0, std::min(kTileWidth, scene_width_ - (tile_index * kTileWidth)), height_);
+    request.begin_clk   = clock_transform_.SceneToFirstClock(request.tile_rect.left());
+    request.end_clk     = clock_transform_.SceneToFirstClock(request.tile_rect.left() + request.tile_rect.width());
+    request.scene_width = scene_width_;
+    request.max_clock   = max_clock_;
+
+    const quint64 generation = generation_;
+    auto          deliver    = [this, key, generation](const QImage& image) {
+        QMetaObject::invokeMethod(
+            this, [this, key, generation, image]() { TileFinished(key, generation, image); }, Qt::QueuedConnection);
+    };
+
+    pending_tiles_.insert(key);
+    thread_pool_->start(new TimelineTileTask(render_function_, request, device_pixel_ratio_, deliver));
+}
+
+void TimelineTileItem::TileFinished(const TileKey& key, quint64 generation, const QImage& image)
+{
+    if (generation != generation_)
+    {
+        return;
+    }
+
+    pending_tiles_.remove(key);
+    const int cost_kib = std::max((int)(image.sizeInBytes() / 1024), 1);
+    tile_cache_.insert(key, new QImage(image), cost_kib);
+
+    if (key.first == scene_width_)
+    {
+        update(QRectF(key.second * kTileWidth, 0, kTileWidth, height_));
+    }
+}
+
+void TimelineTileItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    QTCOMMON_PROFILE_SCOPE("TimelineTileItem::paint");
+
+    if (render_function_ == nullptr || scene_width_ <= 0 || max_clock_ <= 0 || height_ <= 0)
+    {
+        return;
+    }
+
+    const qreal device_pixel_ratio = (widget != nullptr) ? widget->devicePixelRatioF() : 1.0;
+    if (device_pixel_ratio != device_pixel_ratio_)
+    {
+        device_pixel_ratio_ = device_pixel_ratio;
+        ResetTiles();
+    }
+
+    // Render functions usually draw with theme colors, so tiles from another theme are stale.
+    const quint64 theme_generation = QtCommon::QtUtils::ColorTheme::Get().GetThemeGeneration();
+    if (theme_generation != theme_generation_)
+    {
+        theme_generation_ = theme_generation;
+        ResetTiles();
+    }
+
+    const QRectF exposed_rect = option->exposedRect.intersected(boundingRect());
+    if (exposed_rect.isEmpty())
+    {
+        return;
+    }
+
+    const int tile_count = (scene_width_ + kTileWidth - 1) / kTileWidth;
+    const int first_tile = std::max(0, (int)std::floor(exposed_rect.left()) / kTileWidth);
+    const int last_tile  = std::min(tile_count - 1, (int)std::ceil(exposed_rect.right()) / kTileWidth);
+
+    for (int tile_index = first_tile; tile_index <= last_tile; tile_index++)
+    {
+        const QRectF  tile_rect(tile_index * kTileWidth, 0, std::min(kTileWidth, scene_width_ - (tile_index * kTileWidth)), height_);
+        const QImage* tile_image = tile_cache_.object(TileKey(scene_width_, tile_index));
+
+        if (tile_image != nullptr)
+        {
+            painter->drawImage(tile_rect.topLeft(), *tile_image);
+        }
+        else
+        {
+            painter->fillRect(tile_rect, placeholder_color_);
+            RequestTile(tile_index);
+        }
+    }
+
+    // Render just beyond the exposed area as well, so short scrolls find their tiles ready.
+    for (int i = 1; i <= kPrefetchTileCount; i++)
+    {
+        if ((first_tile - i) >= 0)
+        {
+            RequestTile(first_tile - i);
+        }
+
+        if ((last_tile + i) < tile_count)
+        {
+            RequestTile(last_tile + i);
+        }
+    }
+}
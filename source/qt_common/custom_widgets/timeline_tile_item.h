@@ -0,0 +1,125 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for a timeline item rendered in tiles on worker threads.
+//=============================================================================
+
+#ifndef QTCOMMON_CUSTOM_WIDGETS_TIMELINE_TILE_ITEM_H_
+#define QTCOMMON_CUSTOM_WIDGETS_TIMELINE_TILE_ITEM_H_
+
+#include <functional>
+
+#include <QCache>
+#include <QColor>
+#include <QGraphicsObject>
+#include <QImage>
+#include <QPair>
+#include <QSet>
+
+#include "timeline_clock_transform.h"
+
+class QThreadPool;
+
+/// The area of the timeline covered by a single tile.
+struct TimelineTileRequest
+{
+    QRect  tile_rect;    ///< The area of the tile, in item coordinates.
+    qint64 begin_clk;    ///< The clock at the left edge of the tile.
+    qint64 end_clk;      ///< The clock at the right edge of the tile.
+    int    scene_width;  ///< The width of the scene, in pixels, at the tile's zoom level.
+    qint64 max_clock;    ///< The clock value at the right edge of the scene.
+};
+
+/// Class that draws timeline content in fixed-width tiles rasterized on a thread pool.
+///
+/// The item asks for the tiles covering the exposed area, and paints any tile that isn't
+/// ready yet with a placeholder. Tiles are cached per zoom level, so scrolling back over
+/// an area or returning to a previous zoom level reuses the rendered images.
+class TimelineTileItem : public QGraphicsObject
+{
+    Q_OBJECT
+
+public:
+    /// A function that draws the content of a tile. The painter is already translated so
+    /// the function can draw in item coordinates. It is called on worker threads, possibly
+    /// for several tiles at once, so it must be thread-safe and must not touch widgets.
+    typedef std::function<void(QPainter* painter, const TimelineTileRequest& request)> RenderFunction;
+
+    /// Constructor.
+    /// \param parent The parent item.
+    explicit TimelineTileItem(QGraphicsItem* parent = nullptr);
+
+    /// Virtual destructor. Waits for any tiles being rendered.
+    virtual ~TimelineTileItem();
+
+    /// Set the function used to draw tiles, and discard any rendered tiles.
+    /// \param render_function The render function.
+    void SetRenderFunction(const RenderFunction& render_function);
+
+    /// Discard all rendered tiles, for example because the underlying data has changed.
+    void InvalidateTiles();
+
+    /// Set how clocks map to scene coordinates. Should match the owning timeline's ruler.
+    /// \param scene_width The width of the scene, in pixels.
+    /// \param max_clock The clock value at the right edge of the scene.
+    void SetSceneMapping(int scene_width, qint64 max_clock);
+
+    /// Set the height of the item.
+    /// \param height The new height, in pixels.
+    void SetHeight(int height);
+
+    /// Set the color drawn over tiles that are still being rendered.
+    /// \param color The placeholder color.
+    void SetPlaceholderColor(const QColor& color);
+
+    /// Set the maximum number of threads used to render tiles.
+    /// \param thread_count The maximum thread count.
+    void SetMaxThreadCount(int thread_count);
+
+    /// Get the number of tiles queued or being rendered.
+    /// \return The pending tile count.
+    int PendingTileCount() const;
+
+    /// Overridden implementation of Qt's bounding rect for this item.
+    /// \return The item's bounding rectangle.
+    virtual QRectF boundingRect() const Q_DECL_OVERRIDE;
+
+    /// Implementation of Qt's paint for this item.
+    /// \param painter The painter object to use.
+    /// \param option Provides style options for the item, such as its state, exposed area and its level-of-detail hints.
+    /// \param widget Points to the widget that is being painted on if specified.
+    virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) Q_DECL_OVERRIDE;
+
+private:
+    /// Identifies a tile by the scene width it was rendered at and its position.
+    typedef QPair<int, int> TileKey;
+
+    /// Queue a tile for rendering, unless it is already cached or queued.
+    /// \param tile_index The position of the tile along the scene.
+    void RequestTile(int tile_index);
+
+    /// Store a rendered tile. Called on the GUI thread.
+    /// \param key The tile key.
+    /// \param generation The generation the tile was rendered for.
+    /// \param image The rendered tile.
+    void TileFinished(const TileKey& key, quint64 generation, const QImage& image);
+
+    /// Cancel queued tiles and discard the cache.
+    void ResetTiles();
+
+    RenderFunction          render_function_;     ///< Draws the content of a tile.
+    QThreadPool*            thread_pool_;         ///< Threads that render the tiles.
+    QCache<TileKey, QImage> tile_cache_;          ///< Rendered tiles, limited by memory use in KiB.
+    QSet<TileKey>           pending_tiles_;       ///< Tiles queued or being rendered.
+    quint64                 generation_;          ///< Incremented whenever rendered tiles become stale.
+    TimelineClockTransform  clock_transform_;     ///< Maps between clocks and item x-coordinates.
+    int                     scene_width_;         ///< The width of the scene, in pixels.
+    qint64                  max_clock_;           ///< The clock at the right edge of the scene.
+    int                     height_;              ///< The height of the item.
+    qreal                   device_pixel_ratio_;  ///< The device pixel ratio the tiles are rendered at.
+    quint64                 theme_generation_;    ///< The color theme generation the tiles are rendered for.
+    QColor                  placeholder_color_;   ///< Drawn where tiles aren't ready.
+};
+
+#endif  // QTCOMMON_CUSTOM_WIDGETS_TIMELINE_TILE_ITEM_H_
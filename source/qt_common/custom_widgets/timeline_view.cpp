@@ -7,24 +7,40 @@
 
 #include "timeline_view.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include <QAbstractScrollArea>
 #include <QApplication>
 #include <QDebug>
 #include <QMouseEvent>
 #include <QScrollBar>
+#include <QScroller>
 #include <QStyle>
+#include <QTimer>
+#include <QVariantAnimation>
 
 #include "common_definitions.h"
+#include "paint_profiler.h"
 #include "scaling_manager.h"
 
 static const QColor  kSelectionColor            = QColor(0, 118, 215);
 static const quint64 kZoomToSelectionPercentage = 10;
 
+/// The default duration of a navigation animation, in milliseconds.
+static const int kNavigationAnimationDuration = 250;
+
+/// If more than this many milliseconds pass between two animation frames, the view is
+/// falling behind and the next frame skips its content update.
+static const qint64 kNavigationFrameBudget = 25;
+
 TimelineView::TimelineView(QWidget* pParent)
     : QGraphicsView(pParent)
     , ruler_(nullptr)
     , mouse_indicator_(nullptr)
     , selection_box_(nullptr)
+    , lod_item_(nullptr)
+    , tile_item_(nullptr)
     , scene_(nullptr)
     , is_selection_defined_(false)
     , is_selection_held_(false)
@@ -38,6 +54,20 @@ TimelineView::TimelineView(QWidget* pParent)
     , left_scene_bound_(0)
     , right_scene_bound_(0)
     , in_reset_state_(true)
+    , is_ruler_hidden_(false)
+    , incremental_scroll_enabled_(false)
+    , content_index_dirty_(true)
+    , navigation_animation_(nullptr)
+    , navigation_from_()
+    , navigation_to_()
+    , animated_navigation_enabled_(false)
+    , navigation_in_progress_(false)
+    , kinetic_scrolling_enabled_(false)
+    , dropped_navigation_frame_count_(0)
+    , scene_update_timer_(nullptr)
+    , pending_scene_update_flags_(kSceneUpdateNone)
+    , scene_update_request_count_(0)
+    , scene_update_count_(0)
 {
     setMouseTracking(true);
     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
@@ -76,6 +106,19 @@ TimelineView::TimelineView(QWidget* pParent)
     scene_->addItem(mouse_indicator_);
     scene_->addItem(selection_box_);
 
+    scene_update_timer_ = new QTimer(this);
+    scene_update_timer_->setSingleShot(true);
+    scene_update_timer_->setInterval(0);
+    connect(scene_update_timer_, &QTimer::timeout, this, &TimelineView::FlushSceneUpdate);
+
+    navigation_animation_ = new QVariantAnimation(this);
+    navigation_animation_->setStartValue(0.0);
+    navigation_animation_->setEndValue(1.0);
+    navigation_animation_->setDuration(kNavigationAnimationDuration);
+    navigation_animation_->setEasingCurve(QEasingCurve::OutCubic);
+    connect(navigation_animation_, &QVariantAnimation::valueChanged, this, &TimelineView::NavigationAnimationStep);
+    connect(navigation_animation_, &QVariantAnimation::finished, this, &TimelineView::NavigationAnimationFinished);
+
     UpdateScene();
 
     connect(horizontalScrollBar(), &QScrollBar::valueChanged, this, &TimelineView::ScrollBarChanged);
@@ -83,14 +126,21 @@ TimelineView::TimelineView(QWidget* pParent)
 
 TimelineView::~TimelineView()
 {
+    navigation_animation_->stop();
+
     delete mouse_indicator_;
     delete selection_box_;
+    delete lod_item_;
+    delete tile_item_;
     delete ruler_;
     delete scene_;
 }
 
 void TimelineView::UpdateSceneBounds()
 {
+    const qint64 previous_start_clock = viewable_start_clock_;
+    const qint64 previous_end_clock   = viewable_end_clock_;
+
     const QRectF scene_rect = QRectF(0, 0, ruler_config_.width, BasePosY());
     scene_->setSceneRect(scene_rect);
 
@@ -112,16 +162,30 @@ void TimelineView::UpdateSceneBounds()
     }
 
     ruler_->UpdateVisibleBounds(viewable_start_clock_, viewable_end_clock_);
+
+    if (viewable_start_clock_ != previous_start_clock || viewable_end_clock_ != previous_end_clock)
+    {
+        emit ViewableRangeChanged(viewable_start_clock_, viewable_end_clock_);
+    }
 }
 
 int TimelineView::ClockToSceneCoordinate(qint64 clock) const
 {
-    return clock * ((double)ruler_config_.width / (double)ruler_config_.max_time);
+    return (int)ClockTransform().ClockToScene(clock);
 }
 
 qint64 TimelineView::SceneCoordinateToClock(int sceneCoordX) const
 {
-    return (sceneCoordX) * ((double)ruler_config_.max_time / (double)ruler_config_.width);
+    return ClockTransform().SceneToClock(sceneCoordX);
+}
+
+const TimelineClockTransform& TimelineView::ClockTransform() const
+{
+    // Child classes may modify ruler_config_ directly, so sync on use. This is a no-op
+    // unless the ruler has changed.
+    clock_transform_.SetMapping(ruler_config_.max_time, ruler_config_.width);
+
+    return clock_transform_;
 }
 
 void TimelineView::UpdateRuler()
@@ -142,7 +206,7 @@ void TimelineView::SetMaxClock(qint64 clock)
 {
     ruler_config_.max_time = clock;
 
-    UpdateScene();
+    RequestSceneUpdate();
 }
 
 bool TimelineView::GetResetState() const
@@ -150,9 +214,50 @@ bool TimelineView::GetResetState() const
     return in_reset_state_;
 }
 
+void TimelineView::CenterOnClock(qint64 clock)
+{
+    // Everything is already visible when fully zoomed out.
+    if (in_reset_state_ == true)
+    {
+        return;
+    }
+
+    qint64 begin_clk = clock - ((viewable_end_clock_ - viewable_start_clock_) / 2);
+    qint64 end_clk   = begin_clk + (viewable_end_clock_ - viewable_start_clock_);
+    ClampClocks(begin_clk, end_clk);
+
+    SetScrollbarAtClock(begin_clk);
+}
+
 void TimelineView::ScrollBarChanged()
 {
-    UpdateScene();
+    if (incremental_scroll_enabled_ == true)
+    {
+        // QGraphicsView has already scrolled the viewport pixels and queued a repaint of the
+        // exposed strip. The ruler and other items are laid out in scene coordinates, so only
+        // the items that move as a result of this update need repainting.
+        RequestSceneUpdate(kSceneUpdateAll & ~kSceneUpdateViewport);
+    }
+    else
+    {
+        RequestSceneUpdate();
+    }
+}
+
+void TimelineView::SetIncrementalScrollEnabled(bool enabled)
+{
+    incremental_scroll_enabled_ = enabled;
+
+    // Pixel reuse is only possible if the view isn't set to repaint everything.
+    if (enabled == true && viewportUpdateMode() == QGraphicsView::FullViewportUpdate)
+    {
+        setViewportUpdateMode(QGraphicsView::MinimalViewportUpdate);
+    }
+}
+
+bool TimelineView::IsIncrementalScrollEnabled() const
+{
+    return incremental_scroll_enabled_;
 }
 
 void TimelineView::UpdateMouseIndicator()
@@ -200,14 +305,184 @@ void TimelineView::UpdateContent()
 {
 }
 
+void TimelineView::UpdateLevelOfDetail()
+{
+    if (lod_item_ != nullptr)
+    {
+        const int top = (is_ruler_hidden_ == true) ? 0 : kDefaultRulerHeight + 1;
+
+        lod_item_->setPos(0, top);
+        lod_item_->SetSceneMapping(ruler_config_.width, ruler_config_.max_time);
+        lod_item_->SetHeight(std::max(0, BasePosY() - top));
+    }
+}
+
+void TimelineView::SetLevelOfDetailEvents(const QVector<TimelineLodEvent>& events)
+{
+    if (lod_item_ == nullptr)
+    {
+        lod_item_ = new TimelineLodItem();
+        scene_->addItem(lod_item_);
+    }
+
+    lod_item_->SetEvents(events);
+
+    UpdateLevelOfDetail();
+}
+
+TimelineLodItem* TimelineView::LevelOfDetailItem() const
+{
+    return lod_item_;
+}
+
+void TimelineView::UpdateTileItem()
+{
+    if (tile_item_ != nullptr)
+    {
+        const int top = (is_ruler_hidden_ == true) ? 0 : kDefaultRulerHeight + 1;
+
+        tile_item_->setPos(0, top);
+        tile_item_->SetSceneMapping(ruler_config_.width, ruler_config_.max_time);
+        tile_item_->SetHeight(std::max(0, BasePosY() - top));
+    }
+}
+
+void TimelineView::SetTileRenderFunction(const TimelineTileItem::RenderFunction& render_function)
+{
+    if (tile_item_ == nullptr)
+    {
+        tile_item_ = new TimelineTileItem();
+        scene_->addItem(tile_item_);
+    }
+
+    UpdateTileItem();
+
+    tile_item_->SetRenderFunction(render_function);
+}
+
+TimelineTileItem* TimelineView::TileItem() const
+{
+    return tile_item_;
+}
+
 void TimelineView::UpdateScene()
 {
+    QTCOMMON_PROFILE_SCOPE("TimelineView::UpdateScene");
+
+    scene_update_request_count_++;
+
+    // Everything is about to be updated, so drop any pending request.
+    pending_scene_update_flags_ = kSceneUpdateNone;
+    scene_update_timer_->stop();
+
+    UpdateSceneItems();
+
+    viewport()->update();
+
+    scene_update_count_++;
+}
+
+void TimelineView::RequestSceneUpdate(int flags)
+{
+    scene_update_request_count_++;
+
+    // Zoom and scroll calculations read the viewable clocks straight after requesting an
+    // update, so the ruler and scene bounds can't wait.
+    if ((flags & kSceneUpdateRuler) != 0)
+    {
+        UpdateRuler();
+    }
+
+    if ((flags & ~kSceneUpdateRuler) == kSceneUpdateNone)
+    {
+        // Nothing left to defer.
+        scene_update_count_++;
+        return;
+    }
+
+    pending_scene_update_flags_ |= (flags & ~kSceneUpdateRuler);
+
+    if (scene_update_timer_->isActive() == false)
+    {
+        scene_update_timer_->start();
+    }
+}
+
+void TimelineView::FlushSceneUpdate()
+{
+    QTCOMMON_PROFILE_SCOPE("TimelineView::FlushSceneUpdate");
+
+    const int flags = pending_scene_update_flags_;
+
+    pending_scene_update_flags_ = kSceneUpdateNone;
+    scene_update_timer_->stop();
+
+    if (flags == kSceneUpdateNone)
+    {
+        return;
+    }
+
+    if ((flags & kSceneUpdateIndicator) != 0)
+    {
+        UpdateMouseIndicator();
+    }
+
+    if ((flags & kSceneUpdateSelection) != 0)
+    {
+        UpdateSelectionBox();
+    }
+
+    if ((flags & kSceneUpdateContent) != 0)
+    {
+        UpdateLevelOfDetail();
+        UpdateTileItem();
+
+        // Subclasses update their content here; the scope times their override.
+        QTCOMMON_PROFILE_SCOPE("TimelineView::UpdateContent");
+        UpdateContent();
+    }
+
+    if ((flags & kSceneUpdateViewport) != 0)
+    {
+        viewport()->update();
+    }
+
+    scene_update_count_++;
+}
+
+quint64 TimelineView::SceneUpdateRequestCount() const
+{
+    return scene_update_request_count_;
+}
+
+quint64 TimelineView::SceneUpdateCount() const
+{
+    return scene_update_count_;
+}
+
+quint64 TimelineView::CoalescedSceneUpdateCount() const
+{
+    return (scene_update_request_count_ > scene_update_count_) ? (scene_update_request_count_ - scene_update_count_) : 0;
+}
+
+void TimelineView::ResetSceneUpdateCounters()
+{
+    scene_update_request_count_ = 0;
+    scene_update_count_         = 0;
+}
+
+void TimelineView::UpdateSceneItems()
+{
+    QTCOMMON_PROFILE_SCOPE("TimelineView::UpdateSceneItems");
+
     UpdateRuler();
     UpdateMouseIndicator();
     UpdateSelectionBox();
-    UpdateContent();
+    UpdateLevelOfDetail();
+    UpdateTileItem();
 
-    viewport()->update();
+    QTCOMMON_PROFILE_SCOPE("TimelineView::UpdateContent");
+    UpdateContent();
 }
 
 void TimelineView::mousePressEvent(QMouseEvent* event)
@@ -303,6 +578,8 @@ void TimelineView::mouseMoveEvent(QMouseEvent* event)
 
 void TimelineView::resizeEvent(QResizeEvent* event)
 {
+    QTCOMMON_PROFILE_SCOPE("TimelineView::resizeEvent");
+
     QGraphicsView::resizeEvent(event);
 
     if (in_reset_state_ == true)
@@ -317,7 +594,7 @@ void TimelineView::resizeEvent(QResizeEvent* event)
         }
     }
 
-    UpdateScene();
+    RequestSceneUpdate();
 }
 
 bool TimelineView::ZoomInMousePosition()
@@ -369,6 +646,8 @@ bool TimelineView::ZoomIn(int zoom_rate, bool use_mouse_position)
 
 void TimelineView::SetScrollbarAtClock(qint64 begin_clk)
 {
+    const bool animate = BeginAnimatedNavigation();
+
     QScrollBar* graphics_scroll_bar = horizontalScrollBar();
 
     const double clock_percentage    = (double)begin_clk / (double)ruler_config_.max_time;
@@ -376,14 +655,21 @@ void TimelineView::SetScrollbarAtClock(qint64 begin_clk)
     const int    scoll_bar_new_value = graphics_scroll_bar->minimum() + scroll_bar_offset;
 
     graphics_scroll_bar->setValue(scoll_bar_new_value);
+
+    if (animate == true)
+    {
+        EndAnimatedNavigation();
+    }
 }
 
 bool TimelineView::ZoomInClk(qint64 begin_clk, qint64 end_clk)
 {
+    const bool animate = BeginAnimatedNavigation();
+
     // Reset the view before zooming to preserve accuracy.
     ruler_config_.width = MinimumRulerWidth();
     ruler_zoom_factor_  = 1.0f;
-    UpdateScene();
+    RequestSceneUpdate();
 
     qint64 selected_clock_range = end_clk - begin_clk;
 
@@ -426,7 +712,7 @@ bool TimelineView::ZoomInClk(qint64 begin_clk, qint64 end_clk)
 
     in_reset_state_ = false;
 
-    UpdateScene();
+    RequestSceneUpdate();
 
     SetScrollbarAtClock(begin_clk);
 
@@ -437,6 +723,11 @@ bool TimelineView::ZoomInClk(qint64 begin_clk, qint64 end_clk)
         can_zoom_further = true;
     }
 
+    if (animate == true)
+    {
+        EndAnimatedNavigation();
+    }
+
     return can_zoom_further;
 }
 
@@ -535,9 +826,12 @@ bool TimelineView::ZoomOut(int zoomRate, bool useMousePos)
 
 bool TimelineView::ZoomOutClk(qint64 begin_clk, qint64 end_clk, int zoom_rate)
 {
+    const bool animate = BeginAnimatedNavigation();
+
     in_reset_state_ = false;
 
-    int potential_width = ruler_config_.width / zoom_rate;
+    int  potential_width  = ruler_config_.width / zoom_rate;
+    bool can_zoom_further = false;
 
     if (potential_width > MinimumRulerWidth())
     {
@@ -548,29 +842,229 @@ bool TimelineView::ZoomOutClk(qint64 begin_clk, qint64 end_clk, int zoom_rate)
 
         ruler_config_.width = potential_width;
 
-        UpdateScene();
+        RequestSceneUpdate();
 
         SetScrollbarAtClock(begin_clk);
 
-        return true;
+        can_zoom_further = true;
     }
     else
     {
         SetResetState();
 
-        UpdateScene();
+        RequestSceneUpdate();
+    }
 
-        return false;
+    if (animate == true)
+    {
+        EndAnimatedNavigation();
     }
+
+    return can_zoom_further;
 }
 
 void TimelineView::ZoomReset()
 {
+    const bool animate = BeginAnimatedNavigation();
+
     SetResetState();
 
+    RequestSceneUpdate();
+
+    if (animate == true)
+    {
+        EndAnimatedNavigation();
+    }
+}
+
+void TimelineView::SetAnimatedNavigationEnabled(bool enabled)
+{
+    animated_navigation_enabled_ = enabled;
+
+    if (enabled == false && navigation_animation_->state() != QAbstractAnimation::Stopped)
+    {
+        navigation_animation_->stop();
+        NavigationAnimationFinished();
+    }
+}
+
+bool TimelineView::IsAnimatedNavigationEnabled() const
+{
+    return animated_navigation_enabled_;
+}
+
+void TimelineView::SetNavigationAnimationDuration(int msecs)
+{
+    navigation_animation_->setDuration(std::max(msecs, 1));
+}
+
+bool TimelineView::IsNavigationAnimating() const
+{
+    return navigation_animation_->state() == QAbstractAnimation::Running;
+}
+
+quint64 TimelineView::DroppedNavigationFrameCount() const
+{
+    return dropped_navigation_frame_count_;
+}
+
+void TimelineView::SetKineticScrollingEnabled(bool enabled)
+{
+    if (enabled == kinetic_scrolling_enabled_)
+    {
+        return;
+    }
+
+    kinetic_scrolling_enabled_ = enabled;
+
+    // The left button is used for selection, so flicking uses the middle button.
+    if (enabled == true)
+    {
+        QScroller::grabGesture(viewport(), QScroller::MiddleMouseButtonGesture);
+    }
+    else
+    {
+        QScroller::ungrabGesture(viewport());
+    }
+}
+
+bool TimelineView::IsKineticScrollingEnabled() const
+{
+    return kinetic_scrolling_enabled_;
+}
+
+TimelineView::NavigationState TimelineView::CaptureNavigationState() const
+{
+    NavigationState state;
+    state.begin_clk    = viewable_start_clock_;
+    state.end_clk      = viewable_end_clock_;
+    state.ruler_width  = ruler_config_.width;
+    state.zoom_factor  = ruler_zoom_factor_;
+    state.reset_state  = in_reset_state_;
+    state.scroll_value = horizontalScrollBar()->value();
+    return state;
+}
+
+void TimelineView::ApplyNavigationState(const NavigationState& state)
+{
+    ruler_config_.width = state.ruler_width;
+    ruler_zoom_factor_  = state.zoom_factor;
+    in_reset_state_     = state.reset_state;
+
+    // The scroll bar range follows the scene rect, so update the ruler before scrolling.
+    RequestSceneUpdate();
+
+    horizontalScrollBar()->setValue(state.scroll_value);
+}
+
+bool TimelineView::BeginAnimatedNavigation()
+{
+    if (animated_navigation_enabled_ == false || navigation_in_progress_ == true)
+    {
+        return false;
+    }
+
+    navigation_in_progress_ = true;
+
+    // Start from whatever is on screen, but compute the new target relative to the end of
+    // any running animation, so repeated zoom steps accumulate as expected.
+    navigation_from_ = CaptureNavigationState();
+
+    if (navigation_animation_->state() != QAbstractAnimation::Stopped)
+    {
+        navigation_animation_->stop();
+        ApplyNavigationState(navigation_to_);
+    }
+
+    return true;
+}
+
+void TimelineView::EndAnimatedNavigation()
+{
+    navigation_to_ = CaptureNavigationState();
+
+    const bool unchanged = navigation_to_.ruler_width == navigation_from_.ruler_width && navigation_to_.zoom_factor == navigation_from_.zoom_factor &&
+                           navigation_to_.reset_state == navigation_from_.reset_state && navigation_to_.scroll_value == navigation_from_.scroll_value;
+
+    if (unchanged == false)
+    {
+        // The target has been computed, so put the view back and animate towards it.
+        ApplyNavigationState(navigation_from_);
+
+        navigation_frame_timer_.start();
+        navigation_animation_->start();
+    }
+
+    navigation_in_progress_ = false;
+}
+
+void TimelineView::NavigationAnimationStep(const QVariant& value)
+{
+    const double progress = value.toDouble();
+
+    if (navigation_animation_->state() != QAbstractAnimation::Running || progress >= 1.0)
+    {
+        // The final frame is applied exactly by NavigationAnimationFinished().
+        return;
+    }
+
+    // Interpolate the zoom level geometrically, so each frame zooms by the same ratio,
+    // and the center of the range linearly.
+    const double from_range  = std::max((double)(navigation_from_.end_clk - navigation_from_.begin_clk), 1.0);
+    const double to_range    = std::max((double)(navigation_to_.end_clk - navigation_to_.begin_clk), 1.0);
+    const double from_center = (double)(navigation_from_.begin_clk + navigation_from_.end_clk) / 2.0;
+    const double to_center   = (double)(navigation_to_.begin_clk + navigation_to_.end_clk) / 2.0;
+    const double range       = from_range * std::pow(to_range / from_range, progress);
+    const double center      = from_center + ((to_center - from_center) * progress);
+
+    navigation_in_progress_ = true;
+    ZoomInClk((qint64)(center - (range / 2)), (qint64)(center + (range / 2)));
+    navigation_in_progress_ = false;
+
+    // If the last frame took too long, move the ruler but leave the content where it is
+    // for this frame, so the animation keeps up.
+    if (navigation_frame_timer_.restart() > kNavigationFrameBudget && (pending_scene_update_flags_ & kSceneUpdateContent) != 0)
+    {
+        pending_scene_update_flags_ &= ~kSceneUpdateContent;
+        dropped_navigation_frame_count_++;
+    }
+
+    FlushSceneUpdate();
+}
+
+void TimelineView::NavigationAnimationFinished()
+{
+    navigation_in_progress_ = true;
+    ApplyNavigationState(navigation_to_);
+    navigation_in_progress_ = false;
+
     UpdateScene();
 }
 
+void TimelineView::InvalidateContentIndex()
+{
+    content_index_dirty_ = true;
+}
+
+QVector<int> TimelineView::ContentInClockRange(qint64 begin_clk, qint64 end_clk)
+{
+    if (content_index_dirty_ == true || content_index_.Size() != content_.size())
+    {
+        content_index_.Build(content_);
+        content_index_dirty_ = false;
+    }
+
+    QVector<int> item_indices;
+    content_index_.Query(begin_clk, end_clk, item_indices);
+
+    return item_indices;
+}
+
+QVector<int> TimelineView::VisibleContent()
+{
+    return ContentInClockRange(viewable_start_clock_, viewable_end_clock_);
+}
+
 qint64 TimelineView::ViewableStartClk() const
 {
     return viewable_start_clock_;
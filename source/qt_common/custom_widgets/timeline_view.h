@@ -8,6 +8,7 @@
 #ifndef QTCOMMON_CUSTOM_WIDGETS_TIMELINE_VIEW_H_
 #define QTCOMMON_CUSTOM_WIDGETS_TIMELINE_VIEW_H_
 
+#include <QElapsedTimer>
 #include <QGraphicsItem>
 #include <QGraphicsLineItem>
 #include <QGraphicsRectItem>
@@ -15,11 +16,19 @@
 #include <QGraphicsView>
 
 #include "ruler_widget.h"
+#include "timeline_clock_transform.h"
+#include "timeline_item_index.h"
+#include "timeline_lod_item.h"
+#include "timeline_tile_item.h"
+
+class QTimer;
+class QVariantAnimation;
 
 struct TimelineItem
 {
-    QGraphicsItem* item;   ///< Object to add to scene
-    qint64         clock;  ///< What clock does it sit at
+    QGraphicsItem* item;          ///< Object to add to scene
+    qint64         clock;         ///< What clock does it sit at
+    qint64         duration = 0;  ///< How many clocks does it span
 };
 
 /// Holds and controls the timeline visualization
@@ -28,6 +37,18 @@ class TimelineView : public QGraphicsView
     Q_OBJECT
 
 public:
+    /// Flags describing which parts of the scene need updating.
+    enum SceneUpdateFlags
+    {
+        kSceneUpdateNone      = 0x00,  ///< Nothing to update.
+        kSceneUpdateRuler     = 0x01,  ///< The ruler and scene bounds. Always applied immediately.
+        kSceneUpdateIndicator = 0x02,  ///< The mouse indicator.
+        kSceneUpdateSelection = 0x04,  ///< The selection box.
+        kSceneUpdateContent   = 0x08,  ///< The level-of-detail item and the child class content.
+        kSceneUpdateViewport  = 0x10,  ///< A repaint of the whole viewport.
+        kSceneUpdateAll       = 0x1f   ///< Everything.
+    };
+
     /// Constructor
     /// \param parent The parent widget.
     explicit TimelineView(QWidget* parent);
@@ -137,6 +158,12 @@ public:
     /// \param sceneCoordX The scene x-position
     qint64 SceneCoordinateToClock(int sceneCoordX) const;
 
+    /// Get the transform between clocks and scene x-positions for the current ruler.
+    /// Can be used to position many scene items at once, and isn't limited to int
+    /// scene coordinates.
+    /// \return The clock transform.
+    const TimelineClockTransform& ClockTransform() const;
+
     /// Set ruler max clock
     /// \param clock new max clock
     void SetMaxClock(qint64 clock);
@@ -145,10 +172,109 @@ public:
     /// \return the bool backing reset state
     bool GetResetState() const;
 
+    /// Scroll the view, without changing the zoom level, so a clock is in the center.
+    /// \param clock The clock to center on.
+    void CenterOnClock(qint64 clock);
+
+    /// Draw the given events through the built-in level-of-detail item rather than
+    /// through individual scene items. The item is created on first use and covers
+    /// the area below the ruler.
+    /// \param events The events to draw.
+    void SetLevelOfDetailEvents(const QVector<TimelineLodEvent>& events);
+
+    /// Get the built-in level-of-detail item, so its appearance can be customized.
+    /// \return The level-of-detail item, or nullptr if no events have been set.
+    TimelineLodItem* LevelOfDetailItem() const;
+
+    /// Draw content through the built-in tile item, which rasterizes tiles of the timeline
+    /// on a thread pool rather than painting on the GUI thread. The item is created on
+    /// first use and covers the area below the ruler.
+    /// \param render_function The function that draws a tile. Must be thread-safe.
+    void SetTileRenderFunction(const TimelineTileItem::RenderFunction& render_function);
+
+    /// Get the built-in tile item, for example to invalidate the tiles after the data changes.
+    /// \return The tile item, or nullptr if no render function has been set.
+    TimelineTileItem* TileItem() const;
+
+    /// Set whether scrolling repaints only the newly exposed part of the viewport.
+    /// When enabled, the already rendered pixels are shifted by the scrolled amount and
+    /// only changed scene items are redrawn, so child classes must not rely on a full
+    /// viewport repaint after UpdateContent(). Disabled by default.
+    /// \param enabled Whether incremental scrolling is enabled.
+    void SetIncrementalScrollEnabled(bool enabled);
+
+    /// Get whether scrolling repaints only the newly exposed part of the viewport.
+    /// \return true if incremental scrolling is enabled, false otherwise.
+    bool IsIncrementalScrollEnabled() const;
+
+    /// Get the number of scene updates requested, either directly through UpdateScene()
+    /// or through RequestSceneUpdate().
+    /// \return The number of requested scene updates.
+    quint64 SceneUpdateRequestCount() const;
+
+    /// Get the number of scene updates actually performed.
+    /// \return The number of performed scene updates.
+    quint64 SceneUpdateCount() const;
+
+    /// Get the number of requested scene updates that were merged into another update.
+    /// \return The number of coalesced scene updates.
+    quint64 CoalescedSceneUpdateCount() const;
+
+    /// Reset the scene update counters to zero.
+    void ResetSceneUpdateCounters();
+
+    /// Set whether zooming and scrolling to a clock animate smoothly to the new range,
+    /// rather than jumping straight to it. Disabled by default.
+    /// \param enabled Whether animated navigation is enabled.
+    void SetAnimatedNavigationEnabled(bool enabled);
+
+    /// Get whether zooming and scrolling to a clock animate smoothly to the new range.
+    /// \return true if animated navigation is enabled, false otherwise.
+    bool IsAnimatedNavigationEnabled() const;
+
+    /// Set how long a navigation animation takes.
+    /// \param msecs The animation duration, in milliseconds.
+    void SetNavigationAnimationDuration(int msecs);
+
+    /// Get whether a navigation animation is currently running.
+    /// \return true if the view is animating, false otherwise.
+    bool IsNavigationAnimating() const;
+
+    /// Get the number of animation frames whose content update was skipped because the
+    /// previous frame overran its time budget.
+    /// \return The number of dropped content updates.
+    quint64 DroppedNavigationFrameCount() const;
+
+    /// Set whether the view can be flicked with the middle mouse button, continuing to
+    /// scroll with inertia after the button is released. Disabled by default.
+    /// \param enabled Whether kinetic scrolling is enabled.
+    void SetKineticScrollingEnabled(bool enabled);
+
+    /// Get whether kinetic scrolling is enabled.
+    /// \return true if kinetic scrolling is enabled, false otherwise.
+    bool IsKineticScrollingEnabled() const;
+
+signals:
+    /// Emitted when the viewable clock range changes, through zooming, scrolling or resizing.
+    /// \param start_clk The new viewable start clock.
+    /// \param end_clk The new viewable end clock.
+    void ViewableRangeChanged(qint64 start_clk, qint64 end_clk);
+
 protected:
-    /// Update everything in the scene.
+    /// Update everything in the scene immediately, including any pending deferred updates.
     void UpdateScene();
 
+    /// Request an update of parts of the scene. The ruler and scene bounds are updated
+    /// immediately, so the viewable clocks are always current. Everything else is marked
+    /// dirty and updated once when control returns to the event loop, so several requests
+    /// from a single user action result in a single update.
+    /// \param flags A combination of SceneUpdateFlags.
+    void RequestSceneUpdate(int flags = kSceneUpdateAll);
+
+    /// Update everything in the scene without forcing a full viewport repaint. Only the
+    /// areas of scene items that have changed are redrawn.
+    void UpdateSceneItems();
+
     /// Update vertical mouse indicator.
     void UpdateMouseIndicator();
 
@@ -161,6 +287,12 @@ protected:
     /// Update scene bounding rect and limits.
     void UpdateSceneBounds();
 
+    /// Update the level-of-detail item to match the ruler.
+    void UpdateLevelOfDetail();
+
+    /// Update the tile item to match the ruler.
+    void UpdateTileItem();
+
     /// Gets the minimum ruler width.
     /// \return The minimum width of the ruler.
     int MinimumRulerWidth() const;
@@ -206,11 +338,31 @@ protected:
     /// Reset the UI back to starting state.
     void SetResetState();
 
+    /// Mark the content index as stale. Call this after modifying content_ in a way
+    /// that doesn't change its size, such as moving or replacing items.
+    void InvalidateContentIndex();
+
+    /// Find the content items that overlap a clock range.
+    /// The index over content_ is rebuilt first if content_ has changed.
+    /// \param begin_clk The start of the range (inclusive).
+    /// \param end_clk The end of the range (inclusive).
+    /// \return The positions in content_ of the overlapping items, sorted by clock.
+    QVector<int> ContentInClockRange(qint64 begin_clk, qint64 end_clk);
+
+    /// Find the content items that overlap the viewable clock range.
+    /// Can be used by UpdateContent() to avoid visiting every item.
+    /// \return The positions in content_ of the visible items, sorted by clock.
+    QVector<int> VisibleContent();
+
     RulerConfig ruler_config_;  ///< Ruler config
 
+    mutable TimelineClockTransform clock_transform_;  ///< Clock to scene transform, synced with ruler_config_ on use
+
     RulerWidget*       ruler_;            ///< Ruler widget
     QGraphicsLineItem* mouse_indicator_;  ///< Vertical mouse indicator widget
     QGraphicsRectItem* selection_box_;    ///< Selection box widget
+    TimelineLodItem*   lod_item_;         ///< Level-of-detail event item, created on demand
+    TimelineTileItem*  tile_item_;        ///< Tile-rendered content item, created on demand
     QGraphicsScene*    scene_;            ///< Scene containing all widgets
 
     bool   is_selection_defined_;  ///< Track whether the selection changed
@@ -233,11 +385,68 @@ protected:
 
     bool is_ruler_hidden_;  ///< Flag for ruler visibility
 
+    bool incremental_scroll_enabled_;  ///< Flag for repainting only the exposed area when scrolling
+
     QVector<TimelineItem> content_;  ///< Vector of all objects in the scene added by child implementations
 
+    TimelineItemIndex content_index_;        ///< Interval index over content_
+    bool              content_index_dirty_;  ///< Track whether content_index_ needs rebuilding
+
 private slots:
     /// Track scrollbar changes
     void ScrollBarChanged();
+
+    /// Perform any scene updates requested through RequestSceneUpdate().
+    void FlushSceneUpdate();
+
+    /// Apply an intermediate frame of a navigation animation.
+    /// \param value The animation progress, from 0 to 1.
+    void NavigationAnimationStep(const QVariant& value);
+
+    /// Apply the final state of a navigation animation.
+    void NavigationAnimationFinished();
+
+private:
+    /// The zoom and scroll state of the view.
+    struct NavigationState
+    {
+        qint64 begin_clk;     ///< The viewable start clock
+        qint64 end_clk;       ///< The viewable end clock
+        int    ruler_width;   ///< The ruler width
+        double zoom_factor;   ///< The ruler zoom factor
+        bool   reset_state;   ///< Whether the view is in reset state
+        int    scroll_value;  ///< The horizontal scroll bar position
+    };
+
+    /// Get the current zoom and scroll state.
+    /// \return The navigation state.
+    NavigationState CaptureNavigationState() const;
+
+    /// Restore a zoom and scroll state.
+    /// \param state The navigation state to restore.
+    void ApplyNavigationState(const NavigationState& state);
+
+    /// Called at the start of a navigation that may be animated.
+    /// \return true if the navigation will be animated, in which case EndAnimatedNavigation() must be called.
+    bool BeginAnimatedNavigation();
+
+    /// Called at the end of an animated navigation. Moves the view back to where it started
+    /// and animates it to the new state.
+    void EndAnimatedNavigation();
+
+    QVariantAnimation* navigation_animation_;            ///< Animation driving animated navigation
+    QElapsedTimer      navigation_frame_timer_;          ///< Measures the time between animation frames
+    NavigationState    navigation_from_;                 ///< The state an animation starts at
+    NavigationState    navigation_to_;                   ///< The state an animation ends at
+    bool               animated_navigation_enabled_;     ///< Flag for animating zoom and scroll changes
+    bool               navigation_in_progress_;          ///< Set while applying a navigation that shouldn't be animated again
+    bool               kinetic_scrolling_enabled_;       ///< Flag for middle-button kinetic scrolling
+    quint64            dropped_navigation_frame_count_;  ///< The number of animation frames without a content update
+
+    QTimer* scene_update_timer_;          ///< Timer used to defer scene updates to the event loop
+    int     pending_scene_update_flags_;  ///< The SceneUpdateFlags waiting for the next flush
+    quint64 scene_update_request_count_;  ///< The number of scene updates requested
+    quint64 scene_update_count_;          ///< The number of scene updates performed
 };
 
 #endif  // QTCOMMON_CUSTOM_WIDGETS_TIMELINE_VIEW_H_
@@ -18,6 +18,7 @@
 #include <QVBoxLayout>
 
 #include "qt_common/utils/qt_util.h"
+#include "qt_common/utils/style_sheet_registry.h"
 
 namespace
 {
@@ -75,9 +76,7 @@ TooltipWidget::TooltipWidget(QWidget* parent, bool follow_mouse_position, QWidge
     setAttribute(Qt::WA_ShowWithoutActivating);
 
     // Force refresh the style sheet if the color theme changes.
-    connect(&QtCommon::QtUtils::ColorTheme::Get(), &QtCommon::QtUtils::ColorTheme::ColorThemeUpdated, this, [this]() { setStyleSheet(kTooltipStylesheet); });
-
-    setStyleSheet(kTooltipStylesheet);
+    StyleSheetRegistry::Get().Register(this, []() { return kTooltipStylesheet; }, true);
 
     if (container_widget_ != nullptr)
     {
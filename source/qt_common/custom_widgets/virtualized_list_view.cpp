@@ -0,0 +1,161 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of the pop-up list view of a virtualized ArrowIconComboBox.
+//=============================================================================
+
+#include "virtualized_list_view.h"
+
+#include <QApplication>
+#include <QKeyEvent>
+
+#include "common_definitions.h"
+#include "paint_profiler.h"
+#include "qt_util.h"
+#include "scaling_manager.h"
+
+#include "arrow_icon_combo_box.h"
+#include "list_widget.h"
+
+VirtualizedListView::VirtualizedListView(QWidget* parent, ArrowIconComboBox* button)
+    : QListView(parent)
+    , button_(button)
+    , parent_(parent)
+    , show_list_above_button_(false)
+    , header_widget_(nullptr)
+{
+    // All rows are the same height, so the view never needs to measure more than one.
+    setUniformItemSizes(true);
+    setEditTriggers(QAbstractItemView::NoEditTriggers);
+    viewport()->setCursor(Qt::PointingHandCursor);
+
+    connect(&ScalingManager::Get(), &ScalingManager::ScaleFactorChanged, this, &VirtualizedListView::OnScaleFactorChanged);
+}
+
+VirtualizedListView::~VirtualizedListView()
+{
+    disconnect(&ScalingManager::Get(), &ScalingManager::ScaleFactorChanged, this, &VirtualizedListView::OnScaleFactorChanged);
+}
+
+void VirtualizedListView::SetListAboveButton(bool list_above_button)
+{
+    show_list_above_button_ = list_above_button;
+}
+
+void VirtualizedListView::OnScaleFactorChanged()
+{
+    // The item widths change with the font size. The combo box may not have been told yet.
+    if (button_ != nullptr)
+    {
+        button_->InvalidateMaxItemWidth();
+    }
+
+    UpdateSize();
+
+    updateGeometry();
+    update();
+}
+
+int VirtualizedListView::ContentWidth() const
+{
+    if (button_ == nullptr || model() == nullptr || model()->rowCount() == 0)
+    {
+        return 0;
+    }
+
+    int content_width = button_->MaxItemWidth();
+
+    // Leave room for the checkbox painted by the delegate.
+    if (model()->flags(model()->index(0, 0)).testFlag(Qt::ItemIsUserCheckable) == true)
+    {
+        content_width += style()->pixelMetric(QStyle::PM_IndicatorWidth, nullptr, this);
+        content_width += style()->pixelMetric(QStyle::PM_CheckBoxLabelSpacing, nullptr, this);
+    }
+
+    return content_width;
+}
+
+QSize VirtualizedListView::sizeHint() const
+{
+    const int shown_row_count = (button_ != nullptr && model() != nullptr) ? button_->ShownRowCount() : 0;
+
+    // All rows are the same height.
+    const int row_height    = (shown_row_count > 0) ? sizeHintForRow(0) : 0;
+    const int header_height = (header_widget_ != nullptr) ? header_widget_->sizeHint().height() : 0;
+
+    // Always leave room for the scrollbar, so rows aren't clipped under it.
+    const int scroll_bar_width = qApp->style()->pixelMetric(QStyle::PM_ScrollBarExtent);
+
+    return QSize(ContentWidth() + kDefaultCheckBoxWidth + scroll_bar_width + 2 * frameWidth(), (shown_row_count * row_height) + header_height + 2 * frameWidth());
+}
+
+void VirtualizedListView::UpdateSize()
+{
+    QtCommon::QtUtils::InvalidateFontMetrics(this);
+
+    updateGeometry();
+    resize(sizeHint());
+
+    LayoutHeaderWidget();
+}
+
+void VirtualizedListView::SetHeaderWidget(QWidget* header_widget)
+{
+    header_widget_ = header_widget;
+    LayoutHeaderWidget();
+}
+
+void VirtualizedListView::LayoutHeaderWidget()
+{
+    setViewportMargins(0, ListWidget::PlacePopupHeader(this, header_widget_), 0, 0);
+}
+
+void VirtualizedListView::showEvent(QShowEvent* event)
+{
+    // Update size of the widget before setting position.
+    UpdateSize();
+
+    if (button_ != nullptr)
+    {
+        move(ListWidget::PopupListPosition(this, button_, parent_, show_list_above_button_));
+    }
+
+    QListView::showEvent(event);
+}
+
+void VirtualizedListView::paintEvent(QPaintEvent* event)
+{
+    QTCOMMON_PROFILE_SCOPE("VirtualizedListView::paintEvent");
+
+    // Calculate the position when painting just in case the parent pane
+    // has scrolled and the widget needs to be moved accordingly.
+    if (button_ != nullptr)
+    {
+        move(ListWidget::PopupListPosition(this, button_, parent_, show_list_above_button_));
+    }
+
+    QListView::paintEvent(event);
+}
+
+void VirtualizedListView::keyPressEvent(QKeyEvent* event)
+{
+    Q_ASSERT(button_ != nullptr);
+
+    // If the user pressed the escape key, close the list.
+    if (event->key() == Qt::Key_Escape && button_ != nullptr)
+    {
+        emit button_->clicked();
+    }
+    else
+    {
+        QListView::keyPressEvent(event);
+    }
+}
+
+void VirtualizedListView::resizeEvent(QResizeEvent* event)
+{
+    QListView::resizeEvent(event);
+
+    LayoutHeaderWidget();
+}
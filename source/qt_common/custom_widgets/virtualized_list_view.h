@@ -0,0 +1,85 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for the pop-up list view of a virtualized ArrowIconComboBox.
+//=============================================================================
+
+#ifndef QTCOMMON_CUSTOM_WIDGETS_VIRTUALIZED_LIST_VIEW_H_
+#define QTCOMMON_CUSTOM_WIDGETS_VIRTUALIZED_LIST_VIEW_H_
+
+#include <QListView>
+
+class ArrowIconComboBox;
+
+/// Class for the pop-up list of an ArrowIconComboBox whose items live in a model.
+///
+/// Behaves like the ListWidget pop-up, but all rows have the same height and are painted
+/// by a delegate, so only the visible rows cost anything to lay out and paint.
+class VirtualizedListView : public QListView
+{
+    Q_OBJECT
+
+public:
+    /// Constructor.
+    /// \param parent Pointer to the parent widget.
+    /// \param button The associated ArrowIconComboBox.
+    explicit VirtualizedListView(QWidget* parent, ArrowIconComboBox* button);
+
+    /// Destructor.
+    virtual ~VirtualizedListView();
+
+    /// Set whether the list box should go above the button (for list boxes at the
+    /// bottom of the screen)
+    /// \param list_above_button If true, draw the list box above the button. Otherwise
+    /// draw if below (default)
+    void SetListAboveButton(bool list_above_button);
+
+    /// Overridden sizeHint that accounts for all the visible rows in the list. The row count and
+    /// the width of the longest item are kept up to date by the combo box, so no rows are checked.
+    /// \return The preferred size for this list view.
+    virtual QSize sizeHint() const Q_DECL_OVERRIDE;
+
+    /// Update the size of the list view based on its content.
+    void UpdateSize();
+
+    /// Set a widget to show above the items, such as a filter field.
+    /// \param header_widget The widget. The list becomes its parent.
+    void SetHeaderWidget(QWidget* header_widget);
+
+protected:
+    /// When the list is shown, reposition it relative to the button.
+    /// \param event The Qt show event
+    virtual void showEvent(QShowEvent* event) Q_DECL_OVERRIDE;
+
+    /// Reposition the list in case the parent pane has scrolled, then paint it.
+    /// \param event The Qt paint event
+    virtual void paintEvent(QPaintEvent* event) Q_DECL_OVERRIDE;
+
+    /// Close the list on the escape key.
+    /// \param event The Qt key event
+    virtual void keyPressEvent(QKeyEvent* event) Q_DECL_OVERRIDE;
+
+    /// Keep the header widget across the top of the list.
+    /// \param event The Qt resize event
+    virtual void resizeEvent(QResizeEvent* event) Q_DECL_OVERRIDE;
+
+private slots:
+    /// Update the size of the list when the scale factor is changed.
+    void OnScaleFactorChanged();
+
+private:
+    /// Get the width of the widest item, including its checkbox.
+    /// \return The width, in pixels.
+    int ContentWidth() const;
+
+    /// Place the header widget above the items, and leave room for it.
+    void LayoutHeaderWidget();
+
+    ArrowIconComboBox* button_;                  ///< The push button associated with this list.
+    QWidget*           parent_;                  ///< The widget the list is positioned in.
+    bool               show_list_above_button_;  ///< Show the list above the button (true) or below (false).
+    QWidget*           header_widget_;           ///< The widget shown above the items, or nullptr.
+};
+
+#endif  // QTCOMMON_CUSTOM_WIDGETS_VIRTUALIZED_LIST_VIEW_H_
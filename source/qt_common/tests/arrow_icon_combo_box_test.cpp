@@ -0,0 +1,120 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Behavioral tests for ArrowIconComboBox.
+//=============================================================================
+
+#include <QCoreApplication>
+#include <QStringList>
+#include <QWidget>
+#include <QtTest>
+
+#include "qt_common/custom_widgets/arrow_icon_combo_box.h"
+
+/// Class that tests how ArrowIconComboBox shows and hides rows.
+class ArrowIconComboBoxTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    /// Run each test with a list widget and with a virtualized list.
+    void UnhideAfterEarlierRowRemoved_data();
+
+    /// Show a row hidden by the caller, after a row before it was removed.
+    void UnhideAfterEarlierRowRemoved();
+
+    /// Run each test with a list widget and with a virtualized list.
+    void UnhideAfterAllOptionInserted_data();
+
+    /// Show a row hidden by the caller, after the "All" option was inserted before it.
+    void UnhideAfterAllOptionInserted();
+
+private:
+    /// Add the virtualized column to a data-driven test.
+    void AddVirtualizedColumn();
+};
+
+/// Create a multi-select combo box with a filter field.
+/// \param main_parent The pane the combo box is on.
+/// \param virtualized Whether the list is virtualized.
+/// \return The combo box, owned by main_parent.
+static ArrowIconComboBox* CreateComboBox(QWidget* main_parent, bool virtualized)
+{
+    ArrowIconComboBox* combo_box = new ArrowIconComboBox(main_parent);
+    combo_box->SetVirtualized(virtualized);
+    combo_box->InitMultiSelect(main_parent, "Queues");
+    combo_box->SetFilterEnabled(true);
+    return combo_box;
+}
+
+void ArrowIconComboBoxTest::AddVirtualizedColumn()
+{
+    QTest::addColumn<bool>("virtualized");
+    QTest::newRow("ListWidget") << false;
+    QTest::newRow("Virtualized") << true;
+}
+
+void ArrowIconComboBoxTest::UnhideAfterEarlierRowRemoved_data()
+{
+    AddVirtualizedColumn();
+}
+
+void ArrowIconComboBoxTest::UnhideAfterEarlierRowRemoved()
+{
+    QFETCH(bool, virtualized);
+
+    QWidget            main_parent;
+    ArrowIconComboBox* combo_box = CreateComboBox(&main_parent, virtualized);
+    combo_box->AddItems(QStringList({"Queue 0", "Queue 1", "Queue 2"}));
+    QCoreApplication::processEvents();
+
+    combo_box->SetRowHidden(2, true);
+    QVERIFY(combo_box->IsRowHidden(2) == true);
+
+    // The hidden item moves to row 1, and the filter index is built again from the event loop.
+    combo_box->RemoveItem(0);
+    QCoreApplication::processEvents();
+    QVERIFY(combo_box->IsRowHidden(1) == true);
+
+    combo_box->SetRowHidden(1, false);
+    QCoreApplication::processEvents();
+    QVERIFY(combo_box->IsRowHidden(0) == false);
+    QVERIFY(combo_box->IsRowHidden(1) == false);
+}
+
+void ArrowIconComboBoxTest::UnhideAfterAllOptionInserted_data()
+{
+    AddVirtualizedColumn();
+}
+
+void ArrowIconComboBoxTest::UnhideAfterAllOptionInserted()
+{
+    QFETCH(bool, virtualized);
+
+    QWidget            main_parent;
+    ArrowIconComboBox* combo_box = CreateComboBox(&main_parent, virtualized);
+    combo_box->AddItems(QStringList({"Queue 0", "Queue 1"}));
+    QCoreApplication::processEvents();
+
+    combo_box->SetRowHidden(1, true);
+
+    // The "All" option is inserted at the top, moving the hidden item to row 2.
+    combo_box->AddCheckboxItem("All", QVariant(), true, true);
+    QCoreApplication::processEvents();
+    QVERIFY(combo_box->IsRowHidden(1) == false);
+    QVERIFY(combo_box->IsRowHidden(2) == true);
+
+    combo_box->SetRowHidden(2, false);
+    QCoreApplication::processEvents();
+    QVERIFY(combo_box->IsRowHidden(2) == false);
+
+    // The filter still hides the items that don't match, and still shows the unhidden item.
+    combo_box->SetFilterText("Queue 1");
+    QVERIFY(combo_box->IsRowHidden(1) == true);
+    QVERIFY(combo_box->IsRowHidden(2) == false);
+}
+
+QTEST_MAIN(ArrowIconComboBoxTest)
+
+#include "arrow_icon_combo_box_test.moc"
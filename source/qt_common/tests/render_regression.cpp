@@ -0,0 +1,382 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of a utility that checks widget rendering against golden images.
+//=============================================================================
+
+#include "render_regression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include <QApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QWidget>
+
+/// The name of the file holding the timing baselines in the golden directory.
+static const char* kBaselineFileName = "baselines.json";
+
+/// The default largest color channel difference for a pixel to still match. Allows for
+/// small differences in antialiasing between machines.
+static const int kDefaultMaxChannelDifference = 8;
+
+/// The default fraction of pixels allowed not to match.
+static const double kDefaultMaxDifferingFraction = 0.001;
+
+/// The default allowed slowdown, as a fraction of the baseline.
+static const double kDefaultTimingTolerance = 0.25;
+
+/// The default absolute allowed slowdown, in nanoseconds.
+static const qint64 kDefaultTimingToleranceNs = 1000000;
+
+/// The default number of timed renders per step.
+static const int kDefaultRenderRepetitions = 9;
+
+RenderRegression::RenderRegression(const QString& golden_directory)
+    : golden_directory_(golden_directory)
+    , record_mode_(false)
+    , max_channel_difference_(kDefaultMaxChannelDifference)
+    , max_differing_fraction_(kDefaultMaxDifferingFraction)
+    , timing_tolerance_(kDefaultTimingTolerance)
+    , timing_tolerance_ns_(kDefaultTimingToleranceNs)
+    , render_repetitions_(kDefaultRenderRepetitions)
+    , scale_factor_(1.0)
+{
+    QFile baseline_file(QDir(golden_directory_).filePath(kBaselineFileName));
+    if (baseline_file.open(QIODevice::ReadOnly) == true)
+    {
+        const QJsonObject root  = QJsonDocument::fromJson(baseline_file.readAll()).object();
+        const QJsonObject steps = root["steps"].toObject();
+
+        // The tolerances are stored with the baselines, since they depend on the machine the baselines were recorded on.
+        timing_tolerance_    = std::max(0.0, root["timing_tolerance"].toDouble(timing_tolerance_));
+        timing_tolerance_ns_ = std::max((qint64)0, (qint64)root["timing_tolerance_ns"].toDouble((double)timing_tolerance_ns_));
+
+        for (auto step = steps.constBegin(); step != steps.constEnd(); ++step)
+        {
+            const QJsonObject object = step.value().toObject();
+
+            Baseline baseline;
+            baseline.interaction_ns = (qint64)object["interaction_ns"].toDouble(-1);
+            baseline.render_ns      = (qint64)object["render_ns"].toDouble(-1);
+            baselines_.insert(step.key(), baseline);
+        }
+    }
+}
+
+RenderRegression::~RenderRegression()
+{
+}
+
+void RenderRegression::SetRecordMode(bool record_mode)
+{
+    record_mode_ = record_mode;
+}
+
+void RenderRegression::SetPixelTolerance(int max_channel_difference, double max_differing_fraction)
+{
+    max_channel_difference_ = std::max(0, max_channel_difference);
+    max_differing_fraction_ = std::max(0.0, max_differing_fraction);
+}
+
+void RenderRegression::SetTimingTolerance(double fraction, qint64 minimum_ns)
+{
+    timing_tolerance_    = std::max(0.0, fraction);
+    timing_tolerance_ns_ = std::max((qint64)0, minimum_ns);
+}
+
+void RenderRegression::SetRenderRepetitions(int repetitions)
+{
+    render_repetitions_ = std::max(1, repetitions);
+}
+
+void RenderRegression::SetScaleFactor(qreal scale_factor)
+{
+    if (scale_factor > 0.0)
+    {
+        scale_factor_ = scale_factor;
+    }
+}
+
+void RenderRegression::SetOutputDirectory(const QString& output_directory)
+{
+    output_directory_ = output_directory;
+}
+
+QString RenderRegression::GoldenImagePath(const QString& name) const
+{
+    return QDir(golden_directory_).filePath(name + ".png");
+}
+
+bool RenderRegression::HasBaselines() const
+{
+    return baselines_.isEmpty() == false;
+}
+
+bool RenderRegression::HasGoldenImage(const QString& name) const
+{
+    return QFile::exists(GoldenImagePath(name));
+}
+
+QImage RenderRegression::Render(QWidget* widget) const
+{
+    const QSize size = widget->size();
+
+    QImage image(QSize((int)std::ceil(size.width() * scale_factor_), (int)std::ceil(size.height() * scale_factor_)), QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(scale_factor_);
+    image.fill(Qt::transparent);
+    widget->render(&image);
+
+    return image;
+}
+
+void RenderRegression::CompareImages(const QImage& image, const QImage& golden_image, Result& result) const
+{
+    result.differing_pixels       = 0;
+    result.max_channel_difference = 0;
+
+    if (image.size() != golden_image.size())
+    {
+        result.image_matched = false;
+        result.message       = QString("Image size %1x%2 doesn't match golden image size %3x%4.")
+                             .arg(image.width())
+                             .arg(image.height())
+                             .arg(golden_image.width())
+                             .arg(golden_image.height());
+        return;
+    }
+
+    const QImage actual   = image.convertToFormat(QImage::Format_ARGB32);
+    const QImage expected = golden_image.convertToFormat(QImage::Format_ARGB32);
+    QImage       difference_image(actual.size(), QImage::Format_ARGB32);
+
+    for (int y = 0; y < actual.height(); y++)
+    {
+        const QRgb* actual_line     = reinterpret_cast<const QRgb*>(actual.constScanLine(y));
+        const QRgb* expected_line   = reinterpret_cast<const QRgb*>(expected.constScanLine(y));
+        QRgb*       difference_line = reinterpret_cast<QRgb*>(difference_image.scanLine(y));
+
+        for (int x = 0; x < actual.width(); x++)
+        {
+            const QRgb actual_pixel   = actual_line[x];
+            const QRgb expected_pixel = expected_line[x];
+
+            int channel_difference = std::abs(qRed(actual_pixel) - qRed(expected_pixel));
+            channel_difference     = std::max(channel_difference, std::abs(qGreen(actual_pixel) - qGreen(expected_pixel)));
+            channel_difference     = std::max(channel_difference, std::abs(qBlue(actual_pixel) - qBlue(expected_pixel)));
+            channel_difference     = std::max(channel_difference, std::abs(qAlpha(actual_pixel) - qAlpha(expected_pixel)));
+
+            result.max_channel_difference = std::max(result.max_channel_difference, channel_difference);
+
+            if (channel_difference > max_channel_difference_)
+            {
+                result.differing_pixels++;
+                difference_line[x] = qRgb(255, 0, 0);
+            }
+            else
+            {
+                // Show matching pixels faded, so the differences stand out.
+                const int gray     = 192 + (qGray(actual_pixel) / 4);
+                difference_line[x] = qRgb(gray, gray, gray);
+            }
+        }
+    }
+
+    const double max_differing_pixels = max_differing_fraction_ * actual.width() * actual.height();
+    result.image_matched              = (result.differing_pixels <= max_differing_pixels);
+
+    if (result.image_matched == false)
+    {
+        result.message = QString("%1 pixels differ from the golden image, by up to %2.").arg(result.differing_pixels).arg(result.max_channel_difference);
+
+        if (output_directory_.isEmpty() == false && QDir().mkpath(output_directory_) == true)
+        {
+            const QDir output_directory(output_directory_);
+            image.save(output_directory.filePath(result.name + "_actual.png"));
+            difference_image.save(output_directory.filePath(result.name + "_difference.png"));
+        }
+    }
+}
+
+bool RenderRegression::RunStep(const QString& name, QWidget* widget, const Interaction& interaction)
+{
+    if (widget == nullptr)
+    {
+        return false;
+    }
+
+    Result result;
+    result.name                    = name;
+    result.image_matched           = true;
+    result.differing_pixels        = 0;
+    result.max_channel_difference  = 0;
+    result.baseline_interaction_ns = -1;
+    result.baseline_render_ns      = -1;
+    result.timing_regressed        = false;
+
+    // Deliver anything left over from setting up the widget, so it isn't timed as part of the interaction.
+    QApplication::sendPostedEvents();
+
+    QElapsedTimer timer;
+    timer.start();
+    if (interaction != nullptr)
+    {
+        interaction();
+    }
+
+    // Layout changes and update requests are posted, and are part of the cost of the interaction.
+    QApplication::sendPostedEvents();
+    result.interaction_ns = timer.nsecsElapsed();
+
+    // The first render fills caches and is the one compared; the rest are timed.
+    const QImage image = Render(widget);
+
+    QVector<qint64> render_times;
+    for (int i = 0; i < render_repetitions_; i++)
+    {
+        timer.restart();
+        Render(widget);
+        render_times.append(timer.nsecsElapsed());
+    }
+
+    std::nth_element(render_times.begin(), render_times.begin() + (render_times.size() / 2), render_times.end());
+    result.render_ns = render_times[render_times.size() / 2];
+
+    if (record_mode_ == true)
+    {
+        if (QDir().mkpath(golden_directory_) == false || image.save(GoldenImagePath(name)) == false)
+        {
+            result.image_matched = false;
+            result.message       = QString("Couldn't write golden image %1.").arg(GoldenImagePath(name));
+        }
+
+        Baseline baseline;
+        baseline.interaction_ns = result.interaction_ns;
+        baseline.render_ns      = result.render_ns;
+        baselines_.insert(name, baseline);
+    }
+    else
+    {
+        const QImage golden_image(GoldenImagePath(name));
+        if (golden_image.isNull() == true)
+        {
+            result.image_matched = false;
+            result.message       = QString("Golden image %1 is missing.").arg(GoldenImagePath(name));
+        }
+        else
+        {
+            CompareImages(image, golden_image, result);
+        }
+
+        const auto baseline = baselines_.constFind(name);
+        if (baseline != baselines_.constEnd())
+        {
+            result.baseline_interaction_ns = baseline->interaction_ns;
+            result.baseline_render_ns      = baseline->render_ns;
+
+            const auto exceeds_baseline = [this](qint64 time_ns, qint64 baseline_ns) {
+                return (baseline_ns >= 0) && (time_ns > (qint64)(baseline_ns * (1.0 + timing_tolerance_)) + timing_tolerance_ns_);
+            };
+
+            if (exceeds_baseline(result.interaction_ns, result.baseline_interaction_ns) == true ||
+                exceeds_baseline(result.render_ns, result.baseline_render_ns) == true)
+            {
+                result.timing_regressed = true;
+
+                if (result.message.isEmpty() == false)
+                {
+                    result.message += " ";
+                }
+                result.message += QString("Interaction took %1 us (baseline %2 us) and rendering took %3 us (baseline %4 us).")
+                                      .arg(result.interaction_ns / 1000)
+                                      .arg(result.baseline_interaction_ns / 1000)
+                                      .arg(result.render_ns / 1000)
+                                      .arg(result.baseline_render_ns / 1000);
+            }
+        }
+    }
+
+    results_.append(result);
+    return (result.image_matched == true && result.timing_regressed == false);
+}
+
+const QVector<RenderRegression::Result>& RenderRegression::Results() const
+{
+    return results_;
+}
+
+bool RenderRegression::Passed() const
+{
+    for (const Result& result : results_)
+    {
+        if (result.image_matched == false || result.timing_regressed == true)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool RenderRegression::SaveBaselines() const
+{
+    QJsonObject steps;
+    for (auto baseline = baselines_.constBegin(); baseline != baselines_.constEnd(); ++baseline)
+    {
+        QJsonObject object;
+        object["interaction_ns"] = baseline->interaction_ns;
+        object["render_ns"]      = baseline->render_ns;
+        steps[baseline.key()]    = object;
+    }
+
+    QJsonObject root;
+    root["timing_tolerance"]    = timing_tolerance_;
+    root["timing_tolerance_ns"] = timing_tolerance_ns_;
+    root["steps"]               = steps;
+
+    if (QDir().mkpath(golden_directory_) == false)
+    {
+        return false;
+    }
+
+    QFile baseline_file(QDir(golden_directory_).filePath(kBaselineFileName));
+    if (baseline_file.open(QIODevice::WriteOnly | QIODevice::Truncate) == false)
+    {
+        return false;
+    }
+
+    const QByteArray json = QJsonDocument(root).toJson(QJsonDocument::Indented);
+    return baseline_file.write(json) == json.size();
+}
+
+QByteArray RenderRegression::ToJson() const
+{
+    QJsonArray results;
+    for (const Result& result : results_)
+    {
+        QJsonObject object;
+        object["name"]                    = result.name;
+        object["image_matched"]           = result.image_matched;
+        object["differing_pixels"]        = result.differing_pixels;
+        object["max_channel_difference"]  = result.max_channel_difference;
+        object["interaction_ns"]          = result.interaction_ns;
+        object["render_ns"]               = result.render_ns;
+        object["baseline_interaction_ns"] = result.baseline_interaction_ns;
+        object["baseline_render_ns"]      = result.baseline_render_ns;
+        object["timing_regressed"]        = result.timing_regressed;
+        object["message"]                 = result.message;
+        results.append(object);
+    }
+
+    QJsonObject root;
+    root["passed"]  = Passed();
+    root["results"] = results;
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
@@ -0,0 +1,156 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for a utility that checks widget rendering against golden images.
+//=============================================================================
+
+#ifndef QTCOMMON_TESTS_RENDER_REGRESSION_H_
+#define QTCOMMON_TESTS_RENDER_REGRESSION_H_
+
+#include <functional>
+
+#include <QByteArray>
+#include <QHash>
+#include <QImage>
+#include <QString>
+#include <QVector>
+
+class QWidget;
+
+/// Class that drives scripted interactions on widgets and checks the result.
+///
+/// Each step runs an interaction on a widget, renders the widget into an image and
+/// compares it with a golden image stored in the golden directory. The time taken by
+/// the interaction and by rendering is compared with a baseline stored alongside the
+/// golden images. Rendering happens in a QImage, so steps can run with the offscreen
+/// platform plugin (QT_QPA_PLATFORM=offscreen) on machines without a GPU.
+///
+/// In record mode, the golden images and baselines are overwritten instead of compared,
+/// which is how they are created in the first place and updated after intended changes.
+/// Interactions are expected to drive the widget with QTest.
+class RenderRegression
+{
+public:
+    /// An interaction with the widget under test, such as a zoom sequence or a drag.
+    typedef std::function<void()> Interaction;
+
+    /// The outcome of one step.
+    struct Result
+    {
+        QString name;                     ///< The name of the step.
+        bool    image_matched;            ///< Whether the rendered image matched the golden image, or was recorded.
+        int     differing_pixels;         ///< The number of pixels outside the pixel tolerance.
+        int     max_channel_difference;   ///< The largest difference in any color channel.
+        qint64  interaction_ns;           ///< The time taken by the interaction, in nanoseconds.
+        qint64  render_ns;                ///< The median time to render the widget, in nanoseconds.
+        qint64  baseline_interaction_ns;  ///< The baseline interaction time, or -1 if there is none.
+        qint64  baseline_render_ns;       ///< The baseline render time, or -1 if there is none.
+        bool    timing_regressed;         ///< Whether either time exceeded its baseline by more than the tolerance.
+        QString message;                  ///< Describes why the step failed, or is empty.
+    };
+
+    /// Constructor. Loads the timing baselines and tolerances from the golden directory, if present.
+    /// \param golden_directory The directory holding the golden images and baselines.
+    explicit RenderRegression(const QString& golden_directory);
+
+    /// Destructor.
+    ~RenderRegression();
+
+    /// Set whether to record new golden images and baselines instead of comparing.
+    /// \param record_mode true to record, false to compare.
+    void SetRecordMode(bool record_mode);
+
+    /// Set how different a rendered image may be from its golden image.
+    /// \param max_channel_difference The largest difference in a color channel for a pixel to still match.
+    /// \param max_differing_fraction The fraction of pixels allowed to exceed max_channel_difference.
+    void SetPixelTolerance(int max_channel_difference, double max_differing_fraction);
+
+    /// Set how much slower than the baseline a step may be.
+    /// \param fraction The allowed slowdown as a fraction of the baseline, for example 0.25 for 25%.
+    /// \param minimum_ns An absolute allowance added on top, so very short steps aren't flagged by noise.
+    void SetTimingTolerance(double fraction, qint64 minimum_ns);
+
+    /// Set how many times the widget is rendered to time rendering.
+    /// \param repetitions The number of timed renders.
+    void SetRenderRepetitions(int repetitions);
+
+    /// Set the device pixel ratio to render at.
+    /// \param scale_factor The device pixel ratio.
+    void SetScaleFactor(qreal scale_factor);
+
+    /// Set the directory that the rendered and difference images of failed steps are written to.
+    /// \param output_directory The directory, or an empty string to not write them.
+    void SetOutputDirectory(const QString& output_directory);
+
+    /// Check whether any timing baselines were loaded, which means golden images have been recorded.
+    /// \return true if there are baselines, false otherwise.
+    bool HasBaselines() const;
+
+    /// Check whether a step has a golden image to compare with.
+    /// \param name The name of the step.
+    /// \return true if the golden image exists, false otherwise.
+    bool HasGoldenImage(const QString& name) const;
+
+    /// Run an interaction on a widget and check the result.
+    /// \param name The name of the step. Also names the golden image.
+    /// \param widget The widget to render after the interaction.
+    /// \param interaction The interaction, or nullptr to only render.
+    /// \return true if the step matched its golden image and baselines, false otherwise.
+    bool RunStep(const QString& name, QWidget* widget, const Interaction& interaction);
+
+    /// Get the results of all steps so far.
+    /// \return The results.
+    const QVector<Result>& Results() const;
+
+    /// Check whether all steps so far have passed.
+    /// \return true if no step failed, false otherwise.
+    bool Passed() const;
+
+    /// Write the timing baselines to the golden directory. Only baselines of steps run
+    /// in record mode have changed.
+    /// \return true if the baselines were written, false otherwise.
+    bool SaveBaselines() const;
+
+    /// Get the results of all steps so far as a JSON document.
+    /// \return The indented JSON text.
+    QByteArray ToJson() const;
+
+private:
+    /// Render a widget at the configured scale factor.
+    /// \param widget The widget.
+    /// \return The rendered image.
+    QImage Render(QWidget* widget) const;
+
+    /// Compare a rendered image with its golden image, and fill in the image fields of a result.
+    /// \param image The rendered image.
+    /// \param golden_image The golden image.
+    /// \param result The result to fill in.
+    void CompareImages(const QImage& image, const QImage& golden_image, Result& result) const;
+
+    /// Get the path of a golden image.
+    /// \param name The name of the step.
+    /// \return The path.
+    QString GoldenImagePath(const QString& name) const;
+
+    /// The stored times of a step.
+    struct Baseline
+    {
+        qint64 interaction_ns;  ///< The interaction time, in nanoseconds.
+        qint64 render_ns;       ///< The render time, in nanoseconds.
+    };
+
+    QString                  golden_directory_;        ///< The directory holding the golden images and baselines.
+    QString                  output_directory_;        ///< Where images of failed steps are written, or empty.
+    bool                     record_mode_;             ///< Whether to record instead of compare.
+    int                      max_channel_difference_;  ///< The largest channel difference for a pixel to match.
+    double                   max_differing_fraction_;  ///< The fraction of pixels allowed not to match.
+    double                   timing_tolerance_;        ///< The allowed slowdown, as a fraction of the baseline.
+    qint64                   timing_tolerance_ns_;     ///< The absolute allowed slowdown, in nanoseconds.
+    int                      render_repetitions_;      ///< The number of timed renders per step.
+    qreal                    scale_factor_;            ///< The device pixel ratio to render at.
+    QHash<QString, Baseline> baselines_;               ///< The timing baselines, by step name.
+    QVector<Result>          results_;                 ///< The results of all steps so far.
+};
+
+#endif  // QTCOMMON_TESTS_RENDER_REGRESSION_H_
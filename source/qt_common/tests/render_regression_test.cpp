@@ -0,0 +1,253 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Render regression tests for the custom widgets.
+///
+/// Each test drives a widget through a scripted sequence with QTest, checks how the widget
+/// responded, and checks every step against a golden image and a timing baseline in the
+/// goldens directory. Run with QTCOMMON_UPDATE_GOLDENS=1 to record the golden images and
+/// baselines instead, on the same machine and platform plugin (QT_QPA_PLATFORM=offscreen)
+/// that CI uses. Until any are recorded, the comparisons are expected to fail.
+//=============================================================================
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QSignalSpy>
+#include <QStringList>
+#include <QVector>
+#include <QWidget>
+#include <QtTest>
+
+#include "qt_common/custom_widgets/arrow_icon_combo_box.h"
+#include "qt_common/custom_widgets/double_slider_widget.h"
+#include "qt_common/custom_widgets/timeline_view.h"
+
+#include "render_regression.h"
+
+/// The number of clocks covered by the timeline.
+static const qint64 kTimelineMaxClock = 1000000000;
+
+/// The number of events shown on the timeline.
+static const int kTimelineEventCount = 100000;
+
+/// The number of items in the combo box list.
+static const int kComboBoxItemCount = 10000;
+
+/// Class that runs the render regression steps for the custom widgets.
+class RenderRegressionTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// Constructor.
+    RenderRegressionTest()
+        : regression_(nullptr)
+        , record_mode_(false)
+    {
+    }
+
+private slots:
+    /// Set up the render regression checker.
+    void initTestCase();
+
+    /// Zoom the timeline in, out and back to the full range.
+    void TimelineViewZoom();
+
+    /// Drag the lower handle of the double slider.
+    void DoubleSliderWidgetDrag();
+
+    /// Open a virtualized combo box with a large number of items.
+    void ArrowIconComboBoxOpen();
+
+    /// Save the baselines when recording, and write the results.
+    void cleanupTestCase();
+
+private:
+    /// Expect the next step to fail its comparison if no golden images have been recorded yet.
+    /// The interaction and the checks after it still run.
+    /// \param name The name of the step.
+    void ExpectFailWithoutGolden(const QString& name);
+
+    /// Get why the last step failed.
+    /// \return The message of the last step.
+    QString LastMessage() const;
+
+    RenderRegression* regression_;   ///< Checks the steps against the golden images and baselines.
+    bool              record_mode_;  ///< Whether the golden images and baselines are being recorded.
+};
+
+void RenderRegressionTest::initTestCase()
+{
+    record_mode_ = qEnvironmentVariableIntValue("QTCOMMON_UPDATE_GOLDENS") != 0;
+
+    regression_ = new RenderRegression(QTCOMMON_GOLDEN_DIRECTORY);
+    regression_->SetRecordMode(record_mode_);
+    regression_->SetOutputDirectory(QDir(QCoreApplication::applicationDirPath()).filePath("render_regression_output"));
+}
+
+void RenderRegressionTest::cleanupTestCase()
+{
+    if (record_mode_ == true)
+    {
+        QVERIFY2(regression_->SaveBaselines() == true, "Couldn't write the timing baselines.");
+    }
+
+    QFile results_file(QDir(QCoreApplication::applicationDirPath()).filePath("render_regression_results.json"));
+    if (results_file.open(QIODevice::WriteOnly | QIODevice::Truncate) == true)
+    {
+        results_file.write(regression_->ToJson());
+    }
+
+    delete regression_;
+    regression_ = nullptr;
+}
+
+void RenderRegressionTest::ExpectFailWithoutGolden(const QString& name)
+{
+    // Once any goldens are recorded, a missing golden image fails, so deleting or renaming one is noticed.
+    if (record_mode_ == false && regression_->HasBaselines() == false && regression_->HasGoldenImage(name) == false)
+    {
+        QEXPECT_FAIL("", "No golden images have been recorded yet. Record them with QTCOMMON_UPDATE_GOLDENS=1 and QT_QPA_PLATFORM=offscreen.", Continue);
+    }
+}
+
+QString RenderRegressionTest::LastMessage() const
+{
+    return regression_->Results().isEmpty() ? QString() : regression_->Results().last().message;
+}
+
+void RenderRegressionTest::TimelineViewZoom()
+{
+    QVector<TimelineLodEvent> events;
+    events.reserve(kTimelineEventCount);
+
+    // Evenly spaced events with varying durations, so the steps are the same on every run.
+    const qint64 spacing = kTimelineMaxClock / kTimelineEventCount;
+    for (int i = 0; i < kTimelineEventCount; i++)
+    {
+        TimelineLodEvent event;
+        event.clock    = i * spacing;
+        event.duration = ((i * 7919) % (spacing * 4)) + 1;
+        events.append(event);
+    }
+
+    TimelineView view(nullptr);
+    view.resize(800, 200);
+    view.SetMaxClock(kTimelineMaxClock);
+    view.SetLevelOfDetailEvents(events);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QVERIFY(view.GetResetState() == true);
+
+    bool zoomed_in = true;
+
+    ExpectFailWithoutGolden("TimelineViewInitial");
+    QVERIFY2(regression_->RunStep("TimelineViewInitial", &view, nullptr), qPrintable(LastMessage()));
+
+    ExpectFailWithoutGolden("TimelineViewZoomIn");
+    QVERIFY2(regression_->RunStep("TimelineViewZoomIn",
+                                  &view,
+                                  [&view, &zoomed_in]() {
+                                      for (int i = 0; i < 4; i++)
+                                      {
+                                          zoomed_in = view.ZoomIn() && zoomed_in;
+                                          QCoreApplication::processEvents();
+                                      }
+                                  }),
+             qPrintable(LastMessage()));
+    QVERIFY(zoomed_in == true);
+    QVERIFY(view.GetResetState() == false);
+
+    ExpectFailWithoutGolden("TimelineViewZoomOut");
+    QVERIFY2(regression_->RunStep("TimelineViewZoomOut",
+                                  &view,
+                                  [&view]() {
+                                      view.ZoomOut();
+                                      QCoreApplication::processEvents();
+                                  }),
+             qPrintable(LastMessage()));
+    QVERIFY(view.GetResetState() == false);
+
+    ExpectFailWithoutGolden("TimelineViewZoomReset");
+    QVERIFY2(regression_->RunStep("TimelineViewZoomReset",
+                                  &view,
+                                  [&view]() {
+                                      view.ZoomReset();
+                                      QCoreApplication::processEvents();
+                                  }),
+             qPrintable(LastMessage()));
+    QVERIFY(view.GetResetState() == true);
+}
+
+void RenderRegressionTest::DoubleSliderWidgetDrag()
+{
+    DoubleSliderWidget slider(Qt::Horizontal);
+    slider.resize(400, 30);
+    slider.setRange(0, 100);
+    slider.SetSpan(20, 80);
+    slider.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&slider));
+
+    // Pressing nearer the lower handle moves it, wherever the style draws the handles.
+    const QPoint from(slider.width() / 5, slider.height() / 2);
+    const QPoint to(slider.width() / 2, slider.height() / 2);
+
+    ExpectFailWithoutGolden("DoubleSliderWidgetDrag");
+    QVERIFY2(regression_->RunStep("DoubleSliderWidgetDrag",
+                                  &slider,
+                                  [&slider, from, to]() {
+                                      static const int kDragSteps = 10;
+
+                                      QTest::mousePress(&slider, Qt::LeftButton, Qt::NoModifier, from);
+                                      for (int i = 1; i <= kDragSteps; i++)
+                                      {
+                                          QTest::mouseMove(&slider, from + ((to - from) * i) / kDragSteps);
+                                      }
+                                      QTest::mouseRelease(&slider, Qt::LeftButton, Qt::NoModifier, to);
+                                  }),
+             qPrintable(LastMessage()));
+
+    QVERIFY(slider.LowerValue() > 20);
+}
+
+void RenderRegressionTest::ArrowIconComboBoxOpen()
+{
+    QStringList item_texts;
+    item_texts.reserve(kComboBoxItemCount);
+    for (int i = 0; i < kComboBoxItemCount; i++)
+    {
+        item_texts.append(QString("Queue %1").arg(i));
+    }
+
+    // The list is shown on the main parent, so that is what is rendered.
+    QWidget main_parent;
+    main_parent.resize(400, 400);
+
+    ArrowIconComboBox* combo_box = new ArrowIconComboBox(&main_parent);
+    combo_box->SetVirtualized(true);
+    combo_box->InitSingleSelect(&main_parent, "Queue", false);
+    combo_box->AddItems(item_texts);
+    combo_box->move(10, 10);
+    combo_box->resize(combo_box->sizeHint());
+
+    main_parent.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&main_parent));
+
+    QSignalSpy opened_spy(combo_box, &ArrowIconComboBox::Opened);
+
+    ExpectFailWithoutGolden("ArrowIconComboBoxOpen");
+    QVERIFY2(regression_->RunStep("ArrowIconComboBoxOpen",
+                                  &main_parent,
+                                  [combo_box]() {
+                                      QTest::mouseClick(combo_box, Qt::LeftButton);
+                                      QCoreApplication::processEvents();
+                                  }),
+             qPrintable(LastMessage()));
+    QCOMPARE(opened_spy.count(), 1);
+}
+
+QTEST_MAIN(RenderRegressionTest)
+
+#include "render_regression_test.moc"
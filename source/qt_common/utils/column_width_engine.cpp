@@ -0,0 +1,530 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of a cached, parallel table column width calculator.
+//=============================================================================
+
+#include "column_width_engine.h"
+
+#include <algorithm>
+
+#include <QAbstractItemModel>
+#include <QFontMetrics>
+#include <QHash>
+#include <QHeaderView>
+#include <QReadWriteLock>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QStyle>
+#include <QTableView>
+#include <QThreadPool>
+#include <QTreeView>
+
+#include "scaling_manager.h"
+#include "text_width_cache.h"
+
+/// Batches with fewer strings than this are measured on the calling thread.
+static const int kParallelMeasureThreshold = 4096;
+
+/// The number of strings measured by each worker task.
+static const int kMeasureChunkSize = 2048;
+
+/// The maximum number of widths cached per font before that font's cache is discarded.
+static const int kMaxCachedWidthsPerFont = 1 << 16;
+
+namespace
+{
+    /// Text widths shared by all engines, keyed on font and then on string.
+    struct WidthCache
+    {
+        QReadWriteLock                      lock;    ///< Guards the widths.
+        QHash<QString, QHash<QString, int>> widths;  ///< The cached widths, per font key.
+    };
+
+    /// Get the shared width cache. The cache is cleared whenever the scale factor changes.
+    /// \return The width cache.
+    WidthCache& GetWidthCache()
+    {
+        static WidthCache                    cache;
+        static const QMetaObject::Connection connection =
+            QObject::connect(&ScalingManager::Get(), &ScalingManager::ScaleFactorChanged, []() { ColumnWidthEngine::ClearCache(); });
+        Q_UNUSED(connection);
+
+        return cache;
+    }
+
+    /// Measure a range of strings, reading from and then adding to the width cache.
+    /// \param font The font to measure with.
+    /// \param font_key The cache key of the font.
+    /// \param texts The strings to measure.
+    /// \param begin The first string to measure.
+    /// \param end One past the last string to measure.
+    /// \param widths Receives the width of each string.
+    void MeasureRange(const QFont& font, const QString& font_key, const QVector<QString>& texts, int begin, int end, int* widths)
+    {
+        WidthCache& cache     = GetWidthCache();
+        bool        found_all = true;
+
+        {
+            QReadLocker locker(&cache.lock);
+
+            const auto font_widths = cache.widths.constFind(font_key);
+            for (int i = begin; i < end; i++)
+            {
+                widths[i] = -1;
+                if (font_widths != cache.widths.constEnd())
+                {
+                    const auto width = font_widths->constFind(texts[i]);
+                    if (width != font_widths->constEnd())
+                    {
+                        widths[i] = width.value();
+                    }
+                }
+
+                if (widths[i] < 0)
+                {
+                    found_all = false;
+                }
+            }
+        }
+
+        if (found_all == true)
+        {
+            return;
+        }
+
+        // Measure the misses outside the lock, then publish them in one go.
+        TextWidthCache&     text_width_cache = TextWidthCache::Get();
+        QHash<QString, int> measured;
+        for (int i = begin; i < end; i++)
+        {
+            if (widths[i] < 0)
+            {
+                const auto width = measured.constFind(texts[i]);
+                if (width != measured.constEnd())
+                {
+                    widths[i] = width.value();
+                }
+                else
+                {
+                    widths[i] = text_width_cache.Width(font, texts[i]);
+                    measured.insert(texts[i], widths[i]);
+                }
+            }
+        }
+
+        QWriteLocker         locker(&cache.lock);
+        QHash<QString, int>& font_widths = cache.widths[font_key];
+        if ((font_widths.size() + measured.size()) > kMaxCachedWidthsPerFont)
+        {
+            font_widths.clear();
+        }
+
+        for (auto it = measured.constBegin(); it != measured.constEnd(); ++it)
+        {
+            font_widths.insert(it.key(), it.value());
+        }
+    }
+
+    /// Task that measures one chunk of a batch on a worker thread.
+    class MeasureTask : public QRunnable
+    {
+    public:
+        /// Constructor.
+        /// \param font The font to measure with.
+        /// \param font_key The cache key of the font.
+        /// \param texts The strings to measure.
+        /// \param begin The first string to measure.
+        /// \param end One past the last string to measure.
+        /// \param widths Receives the width of each string.
+        /// \param done Released once the chunk has been measured.
+        MeasureTask(const QFont& font, const QString& font_key, const QVector<QString>& texts, int begin, int end, int* widths, QSemaphore* done)
+            : font_(font)
+            , font_key_(font_key)
+            , texts_(texts)
+            , begin_(begin)
+            , end_(end)
+            , widths_(widths)
+            , done_(done)
+        {
+        }
+
+        /// Measure the chunk.
+        virtual void run() Q_DECL_OVERRIDE
+        {
+            MeasureRange(font_, font_key_, texts_, begin_, end_, widths_);
+            done_->release();
+        }
+
+    private:
+        const QFont             font_;      ///< The font to measure with.
+        const QString           font_key_;  ///< The cache key of the font.
+        const QVector<QString>& texts_;     ///< The strings to measure.
+        int                     begin_;     ///< The first string to measure.
+        int                     end_;       ///< One past the last string to measure.
+        int*                    widths_;    ///< Receives the width of each string.
+        QSemaphore*             done_;      ///< Released once the chunk has been measured.
+    };
+
+    /// Get the margin the style adds to each side of a header section.
+    /// \param header The header.
+    /// \return The margin, in pixels.
+    int GetHeaderMargin(QHeaderView* header)
+    {
+        int     margin = 0;
+        QStyle* style  = header->style();
+        if (style != nullptr)
+        {
+            margin = style->pixelMetric(QStyle::PM_HeaderMargin, 0, header);
+        }
+
+        return margin;
+    }
+}  // namespace
+
+ColumnWidthEngine::ColumnWidthEngine(QObject* parent)
+    : QObject(parent)
+    , max_rows_(0)
+    , padding_(0)
+    , max_width_(0)
+    , margin_(0)
+    , elide_width_(0)
+{
+}
+
+ColumnWidthEngine::~ColumnWidthEngine()
+{
+    Detach();
+}
+
+int ColumnWidthEngine::TextWidth(const QFont& font, const QString& text)
+{
+    int width = 0;
+    MeasureRange(font, font.key(), QVector<QString>(1, text), 0, 1, &width);
+    return width;
+}
+
+QVector<int> ColumnWidthEngine::MeasureTexts(const QFont& font, const QVector<QString>& texts)
+{
+    const int     count    = texts.size();
+    const QString font_key = font.key();
+    QVector<int>  widths(count);
+    int*          widths_data = widths.data();
+
+    if (count < kParallelMeasureThreshold)
+    {
+        MeasureRange(font, font_key, texts, 0, count, widths_data);
+        return widths;
+    }
+
+    // The first chunk is measured here while the workers handle the rest.
+    const int  chunk_count = (count + kMeasureChunkSize - 1) / kMeasureChunkSize;
+    QSemaphore done;
+    for (int chunk = 1; chunk < chunk_count; chunk++)
+    {
+        const int begin = chunk * kMeasureChunkSize;
+        const int end   = std::min(begin + kMeasureChunkSize, count);
+        MeasureTask* task = new MeasureTask(font, font_key, texts, begin, end, widths_data, &done);
+
+        // Only hand the chunk to a thread that can start it now. A queued chunk could wait behind this
+        // thread, which blocks below, if this is itself a pool thread.
+        if (QThreadPool::globalInstance()->tryStart(task) == false)
+        {
+            task->run();
+            delete task;
+        }
+    }
+
+    MeasureRange(font, font_key, texts, 0, std::min(kMeasureChunkSize, count), widths_data);
+    done.acquire(chunk_count - 1);
+
+    return widths;
+}
+
+void ColumnWidthEngine::ClearCache()
+{
+    WidthCache&  cache = GetWidthCache();
+    QWriteLocker locker(&cache.lock);
+    cache.widths.clear();
+}
+
+QVector<int> ColumnWidthEngine::ComputeColumnWidths(QAbstractItemModel* model, QHeaderView* header, const QFont& cell_font, int max_rows, int padding)
+{
+    Q_ASSERT(model);
+    Q_ASSERT(header);
+
+    const int    column_count = header->count();
+    const int    row_count    = std::max(0, std::min(model->rowCount(), max_rows));
+    const int    margin       = GetHeaderMargin(header);
+    const int    elide_width  = TextWidth(cell_font, QString(QChar(0x2026)));
+    QVector<int> column_widths(column_count);
+
+    // Snapshot the strings here, since the model may only be accessed from the GUI thread.
+    QVector<QString> header_texts(column_count);
+    QVector<QString> cell_texts(column_count * row_count);
+    for (int column = 0; column < column_count; column++)
+    {
+        header_texts[column] = model->headerData(column, Qt::Horizontal).toString().trimmed();
+        for (int row = 0; row < row_count; row++)
+        {
+            cell_texts[column * row_count + row] = model->data(model->index(row, column)).toString().trimmed();
+        }
+    }
+
+    const QVector<int> header_widths = MeasureTexts(header->font(), header_texts);
+    const QVector<int> cell_widths   = MeasureTexts(cell_font, cell_texts);
+
+    for (int column = 0; column < column_count; column++)
+    {
+        column_widths[column] = header_widths[column] + padding + (margin * 2);
+        for (int row = 0; row < row_count; row++)
+        {
+            column_widths[column] = std::max(column_widths[column], cell_widths[column * row_count + row] + elide_width);
+        }
+    }
+
+    return column_widths;
+}
+
+void ColumnWidthEngine::ApplyColumnWidths(QHeaderView* header, const QVector<int>& column_widths, int padding, int max_width)
+{
+    Q_ASSERT(header);
+
+    const int column_count = std::min(header->count(), column_widths.size());
+    for (int column = 0; column < column_count; column++)
+    {
+        if ((max_width == 0) || ((column_widths[column] + padding) < max_width))
+        {
+            header->resizeSection(column, column_widths[column] + padding);
+        }
+        else
+        {
+            header->resizeSection(column, max_width);
+        }
+    }
+}
+
+void ColumnWidthEngine::Attach(QTreeView* tree_view, int max_rows, int padding, int max_width)
+{
+    Q_ASSERT(tree_view);
+    AttachView(tree_view, tree_view->header(), max_rows, padding, max_width);
+}
+
+void ColumnWidthEngine::Attach(QTableView* table, int max_rows, int padding, int max_width)
+{
+    Q_ASSERT(table);
+    AttachView(table, table->horizontalHeader(), max_rows, padding, max_width);
+}
+
+void ColumnWidthEngine::AttachView(QAbstractItemView* view, QHeaderView* header, int max_rows, int padding, int max_width)
+{
+    Detach();
+
+    if (header == nullptr || view->model() == nullptr)
+    {
+        return;
+    }
+
+    view_      = view;
+    header_    = header;
+    model_     = view->model();
+    max_rows_  = max_rows;
+    padding_   = padding;
+    max_width_ = max_width;
+
+    connections_.append(connect(model_, &QAbstractItemModel::dataChanged, this, &ColumnWidthEngine::OnDataChanged));
+    connections_.append(connect(model_, &QAbstractItemModel::rowsInserted, this, &ColumnWidthEngine::OnRowsInserted));
+    connections_.append(connect(model_, &QAbstractItemModel::rowsRemoved, this, &ColumnWidthEngine::OnRowsRemoved));
+    connections_.append(connect(model_, &QAbstractItemModel::headerDataChanged, this, &ColumnWidthEngine::OnHeaderDataChanged));
+    connections_.append(connect(model_, &QAbstractItemModel::columnsInserted, this, &ColumnWidthEngine::Remeasure));
+    connections_.append(connect(model_, &QAbstractItemModel::columnsRemoved, this, &ColumnWidthEngine::Remeasure));
+    connections_.append(connect(model_, &QAbstractItemModel::rowsMoved, this, &ColumnWidthEngine::Remeasure));
+    connections_.append(connect(model_, &QAbstractItemModel::layoutChanged, this, &ColumnWidthEngine::Remeasure));
+    connections_.append(connect(model_, &QAbstractItemModel::modelReset, this, &ColumnWidthEngine::Remeasure));
+
+    Remeasure();
+}
+
+void ColumnWidthEngine::Detach()
+{
+    for (const QMetaObject::Connection& connection : connections_)
+    {
+        disconnect(connection);
+    }
+
+    connections_.clear();
+    view_.clear();
+    header_.clear();
+    model_.clear();
+    header_widths_.clear();
+    cell_widths_.clear();
+}
+
+void ColumnWidthEngine::OnDataChanged(const QModelIndex& top_left, const QModelIndex& bottom_right)
+{
+    if (top_left.parent().isValid() || cell_widths_.isEmpty())
+    {
+        return;
+    }
+
+    const int sampled_rows = cell_widths_[0].size();
+    const int last         = std::min(bottom_right.row(), sampled_rows - 1);
+    if (top_left.row() <= last)
+    {
+        MeasureRows(top_left.row(), last);
+        ApplyWidths();
+    }
+}
+
+void ColumnWidthEngine::OnRowsInserted(const QModelIndex& parent, int first, int last)
+{
+    if (parent.isValid() || model_.isNull() || cell_widths_.isEmpty() || first >= max_rows_)
+    {
+        return;
+    }
+
+    // Make room for the new rows, and drop the rows pushed out of the sampled range.
+    const int sampled_rows = std::min(model_->rowCount(), max_rows_);
+    const int new_rows     = std::min(last, sampled_rows - 1) - first + 1;
+    for (QVector<int>& widths : cell_widths_)
+    {
+        widths.insert(first, new_rows, 0);
+        widths.resize(sampled_rows);
+    }
+
+    MeasureRows(first, first + new_rows - 1);
+    ApplyWidths();
+}
+
+void ColumnWidthEngine::OnRowsRemoved(const QModelIndex& parent, int first, int last)
+{
+    if (parent.isValid() || model_.isNull() || cell_widths_.isEmpty())
+    {
+        return;
+    }
+
+    const int old_sampled_rows = cell_widths_[0].size();
+    if (first >= old_sampled_rows)
+    {
+        return;
+    }
+
+    for (QVector<int>& widths : cell_widths_)
+    {
+        widths.remove(first, std::min(last, old_sampled_rows - 1) - first + 1);
+    }
+
+    // Rows that were past the sampled range may have moved into it.
+    const int remaining_rows = cell_widths_[0].size();
+    const int sampled_rows   = std::min(model_->rowCount(), max_rows_);
+    if (sampled_rows > remaining_rows)
+    {
+        for (QVector<int>& widths : cell_widths_)
+        {
+            widths.resize(sampled_rows);
+        }
+
+        MeasureRows(remaining_rows, sampled_rows - 1);
+    }
+
+    ApplyWidths();
+}
+
+void ColumnWidthEngine::OnHeaderDataChanged(Qt::Orientation orientation)
+{
+    if (orientation == Qt::Horizontal)
+    {
+        MeasureHeader();
+        ApplyWidths();
+    }
+}
+
+void ColumnWidthEngine::Remeasure()
+{
+    if (view_.isNull() || header_.isNull() || model_.isNull())
+    {
+        return;
+    }
+
+    const int column_count = header_->count();
+    const int sampled_rows = std::max(0, std::min(model_->rowCount(), max_rows_));
+
+    margin_      = GetHeaderMargin(header_);
+    elide_width_ = TextWidth(view_->font(), QString(QChar(0x2026)));
+
+    QFontMetrics fm(header_->font());
+    header_->setFixedHeight(fm.height() + (margin_ * 2));
+    header_->setSectionResizeMode(QHeaderView::Interactive);
+
+    cell_widths_.fill(QVector<int>(sampled_rows, 0), column_count);
+    MeasureHeader();
+    MeasureRows(0, sampled_rows - 1);
+    ApplyWidths();
+}
+
+void ColumnWidthEngine::MeasureRows(int first, int last)
+{
+    const int column_count = cell_widths_.size();
+    const int row_count    = last - first + 1;
+    if (view_.isNull() || model_.isNull() || row_count <= 0)
+    {
+        return;
+    }
+
+    QVector<QString> texts(column_count * row_count);
+    for (int column = 0; column < column_count; column++)
+    {
+        for (int row = 0; row < row_count; row++)
+        {
+            texts[column * row_count + row] = model_->data(model_->index(first + row, column)).toString().trimmed();
+        }
+    }
+
+    const QVector<int> widths = MeasureTexts(view_->font(), texts);
+    for (int column = 0; column < column_count; column++)
+    {
+        for (int row = 0; row < row_count; row++)
+        {
+            cell_widths_[column][first + row] = widths[column * row_count + row];
+        }
+    }
+}
+
+void ColumnWidthEngine::MeasureHeader()
+{
+    if (header_.isNull() || model_.isNull())
+    {
+        return;
+    }
+
+    const int        column_count = cell_widths_.size();
+    QVector<QString> texts(column_count);
+    for (int column = 0; column < column_count; column++)
+    {
+        texts[column] = model_->headerData(column, Qt::Horizontal).toString().trimmed();
+    }
+
+    header_widths_ = MeasureTexts(header_->font(), texts);
+}
+
+void ColumnWidthEngine::ApplyWidths()
+{
+    if (header_.isNull())
+    {
+        return;
+    }
+
+    const int    column_count = std::min(header_widths_.size(), cell_widths_.size());
+    QVector<int> column_widths(column_count);
+    for (int column = 0; column < column_count; column++)
+    {
+        column_widths[column] = header_widths_[column] + padding_ + (margin_ * 2);
+        for (int width : cell_widths_[column])
+        {
+            column_widths[column] = std::max(column_widths[column], width + elide_width_);
+        }
+    }
+
+    ApplyColumnWidths(header_, column_widths, padding_, max_width_);
+}
@@ -0,0 +1,152 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for a cached, parallel table column width calculator.
+//=============================================================================
+
+#ifndef QTCOMMON_UTILS_COLUMN_WIDTH_ENGINE_H_
+#define QTCOMMON_UTILS_COLUMN_WIDTH_ENGINE_H_
+
+#include <QFont>
+#include <QMetaObject>
+#include <QModelIndex>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QVector>
+
+class QAbstractItemModel;
+class QAbstractItemView;
+class QHeaderView;
+class QTableView;
+class QTreeView;
+
+/// Class that computes the widths table columns need to show their contents.
+///
+/// Text widths are memoized per font, and large batches of cells are measured on worker
+/// threads from a snapshot of the cell strings taken on the GUI thread. An engine can also
+/// be attached to a view, in which case it keeps the column widths up to date by only
+/// re-measuring the rows reported by the model's change signals.
+class ColumnWidthEngine : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// Explicit constructor
+    /// \param parent The parent object.
+    explicit ColumnWidthEngine(QObject* parent = nullptr);
+
+    /// Destructor
+    virtual ~ColumnWidthEngine();
+
+    /// Measure the width of a string, using the width cache. Thread-safe.
+    /// \param font The font to measure with.
+    /// \param text The string to measure.
+    /// \return The string width, in pixels.
+    static int TextWidth(const QFont& font, const QString& text);
+
+    /// Measure the widths of many strings, using the width cache. Large batches are split
+    /// across idle threads of the global thread pool, and chunks that no thread is free for
+    /// are measured on the calling thread. Thread-safe, including from pool threads.
+    /// \param font The font to measure with.
+    /// \param texts The strings to measure.
+    /// \return The width of each string, in pixels.
+    static QVector<int> MeasureTexts(const QFont& font, const QVector<QString>& texts);
+
+    /// Discard all cached text widths.
+    static void ClearCache();
+
+    /// Compute the width each column needs to show its header label and the cell data in
+    /// its first rows. Must be called on the GUI thread.
+    /// \param model The model to measure.
+    /// \param header The horizontal header of the view showing the model.
+    /// \param cell_font The font used to draw the cells.
+    /// \param max_rows Maximum number of rows to sample when calculating column width.
+    /// \param padding Additional pixels added to the width of each header label.
+    /// \return The width of each column, in pixels.
+    static QVector<int> ComputeColumnWidths(QAbstractItemModel* model, QHeaderView* header, const QFont& cell_font, int max_rows, int padding);
+
+    /// Resize the sections of a header to the given column widths.
+    /// \param header The header to resize.
+    /// \param column_widths The width of each column.
+    /// \param padding Additional pixels added to each column width.
+    /// \param max_width Maximum width (in pixels) allowed for column.  Ignored if set to zero.
+    static void ApplyColumnWidths(QHeaderView* header, const QVector<int>& column_widths, int padding, int max_width);
+
+    /// Size the columns of a tree view, and keep them sized as its model changes.
+    /// \param tree_view The tree view.
+    /// \param max_rows Maximum number of rows to sample when calculating column width.
+    /// \param padding Additional pixels added to the calculated width of the longest string.
+    /// \param max_width Maximum width (in pixels) allowed for column.  Ignored if set to zero.
+    void Attach(QTreeView* tree_view, int max_rows = 32, int padding = 0, int max_width = 0);
+
+    /// Size the columns of a table view, and keep them sized as its model changes.
+    /// \param table The table view.
+    /// \param max_rows Maximum number of rows to sample when calculating column width.
+    /// \param padding Additional pixels added to the calculated width of the longest string.
+    /// \param max_width Maximum width (in pixels) allowed for column.  Ignored if set to zero.
+    void Attach(QTableView* table, int max_rows = 32, int padding = 0, int max_width = 0);
+
+    /// Stop keeping the attached view's columns sized.
+    void Detach();
+
+private slots:
+    /// Re-measure the changed rows.
+    /// \param top_left The top-left changed index.
+    /// \param bottom_right The bottom-right changed index.
+    void OnDataChanged(const QModelIndex& top_left, const QModelIndex& bottom_right);
+
+    /// Measure the inserted rows.
+    /// \param parent The parent of the inserted rows.
+    /// \param first The first inserted row.
+    /// \param last The last inserted row.
+    void OnRowsInserted(const QModelIndex& parent, int first, int last);
+
+    /// Forget the removed rows.
+    /// \param parent The parent of the removed rows.
+    /// \param first The first removed row.
+    /// \param last The last removed row.
+    void OnRowsRemoved(const QModelIndex& parent, int first, int last);
+
+    /// Re-measure the header labels.
+    /// \param orientation The orientation of the changed header.
+    void OnHeaderDataChanged(Qt::Orientation orientation);
+
+    /// Re-measure everything.
+    void Remeasure();
+
+private:
+    /// Start tracking a view.
+    /// \param view The view.
+    /// \param header The horizontal header of the view.
+    /// \param max_rows Maximum number of rows to sample when calculating column width.
+    /// \param padding Additional pixels added to the calculated width of the longest string.
+    /// \param max_width Maximum width (in pixels) allowed for column.  Ignored if set to zero.
+    void AttachView(QAbstractItemView* view, QHeaderView* header, int max_rows, int padding, int max_width);
+
+    /// Measure a range of sampled rows into cell_widths_.
+    /// \param first The first row.
+    /// \param last The last row.
+    void MeasureRows(int first, int last);
+
+    /// Measure the header labels into header_widths_.
+    void MeasureHeader();
+
+    /// Combine the header and cell widths and resize the header sections.
+    void ApplyWidths();
+
+    QPointer<QAbstractItemView>      view_;           ///< The attached view
+    QPointer<QHeaderView>            header_;         ///< The horizontal header of the attached view
+    QPointer<QAbstractItemModel>     model_;          ///< The model of the attached view
+    QVector<QMetaObject::Connection> connections_;    ///< Connections to the model
+    int                              max_rows_;       ///< Maximum number of rows to sample
+    int                              padding_;        ///< Additional pixels added to each column
+    int                              max_width_;      ///< Maximum column width, or zero for no limit
+    int                              margin_;         ///< The header section margin
+    int                              elide_width_;    ///< The width of an ellipsis in the cell font
+    QVector<int>                     header_widths_;  ///< The width needed by each header label
+    QVector<QVector<int>>            cell_widths_;    ///< The width of each sampled row, per column
+};
+
+#endif  // QTCOMMON_UTILS_COLUMN_WIDTH_ENGINE_H_
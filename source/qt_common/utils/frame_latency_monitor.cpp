@@ -0,0 +1,398 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of the FrameLatencyMonitor.
+//=============================================================================
+
+#include "frame_latency_monitor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QAbstractEventDispatcher>
+#include <QAbstractScrollArea>
+#include <QApplication>
+#include <QEvent>
+#include <QThread>
+#include <QtAlgorithms>
+
+#include "paint_profiler.h"
+
+/// The number of bits of precision kept for each value. Each power of two is split into
+/// 2^(kSubBucketBits - 1) buckets, which bounds the relative error to 1 / 2^(kSubBucketBits - 1).
+static const int kSubBucketBits = 7;
+
+/// The number of buckets for each power of two above the linear range.
+static const int kSubBucketHalfCount = 1 << (kSubBucketBits - 1);
+
+/// Values from 0 up to this are counted exactly.
+static const int kSubBucketCount = 1 << kSubBucketBits;
+
+/// Values above 2^kMaxValueBits microseconds (about 12 days) are counted as that value.
+static const int kMaxValueBits = 40;
+
+/// The total number of buckets.
+static const int kBucketCount = (kMaxValueBits - kSubBucketBits + 3) * kSubBucketHalfCount;
+
+/// The default frame rate below which FrameRateBelowTarget is emitted.
+static const double kDefaultTargetFrameRate = 60.0;
+
+/// The default time between reports, in milliseconds.
+static const int kDefaultReportIntervalMs = 1000;
+
+LatencyHistogram::LatencyHistogram()
+    : counts_(kBucketCount, 0)
+    , count_(0)
+    , max_(0)
+{
+}
+
+int LatencyHistogram::BucketIndex(qint64 value_us)
+{
+    const quint64 value = (quint64)std::min(std::max(value_us, (qint64)0), ((qint64)1 << kMaxValueBits));
+    if (value < (quint64)kSubBucketCount)
+    {
+        return (int)value;
+    }
+
+    // Keep the top kSubBucketBits bits of the value; the shift selects the power of two.
+    const int highest_bit = 63 - (int)qCountLeadingZeroBits(value);
+    const int shift       = highest_bit - (kSubBucketBits - 1);
+    return ((shift + 1) * kSubBucketHalfCount) + (int)(value >> shift) - kSubBucketHalfCount;
+}
+
+qint64 LatencyHistogram::BucketUpperBound(int index)
+{
+    if (index < kSubBucketCount)
+    {
+        return index;
+    }
+
+    const int    shift     = (index / kSubBucketHalfCount) - 1;
+    const qint64 sub_value = (index % kSubBucketHalfCount) + kSubBucketHalfCount;
+    return ((sub_value + 1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(qint64 value_us)
+{
+    value_us = std::max(value_us, (qint64)0);
+
+    counts_[BucketIndex(value_us)]++;
+    count_++;
+    max_ = std::max(max_, value_us);
+}
+
+void LatencyHistogram::Reset()
+{
+    counts_.fill(0);
+    count_ = 0;
+    max_   = 0;
+}
+
+quint64 LatencyHistogram::Count() const
+{
+    return count_;
+}
+
+qint64 LatencyHistogram::Max() const
+{
+    return max_;
+}
+
+qint64 LatencyHistogram::Percentile(double percentile) const
+{
+    if (count_ == 0)
+    {
+        return 0;
+    }
+
+    percentile         = std::min(std::max(percentile, 0.0), 100.0);
+    const quint64 rank = std::max((quint64)std::ceil((percentile / 100.0) * (double)count_), (quint64)1);
+
+    quint64 cumulative_count = 0;
+    for (int i = 0; i < kBucketCount; i++)
+    {
+        cumulative_count += counts_[i];
+        if (cumulative_count >= rank)
+        {
+            return std::min(BucketUpperBound(i), max_);
+        }
+    }
+
+    return max_;
+}
+
+FrameLatencyMonitor& FrameLatencyMonitor::Get()
+{
+    static FrameLatencyMonitor instance;
+    return instance;
+}
+
+FrameLatencyMonitor::FrameLatencyMonitor()
+    : slow_frame_count_(0)
+    , target_frame_time_us_(qRound64(1000000.0 / kDefaultTargetFrameRate))
+    , wake_ns_(0)
+    , idle_ns_(-1)
+    , pending_input_ns_(-1)
+    , painted_(false)
+    , running_(false)
+{
+    clock_.start();
+
+    report_timer_.setInterval(kDefaultReportIntervalMs);
+    connect(&report_timer_, &QTimer::timeout, this, &FrameLatencyMonitor::Report);
+}
+
+FrameLatencyMonitor::~FrameLatencyMonitor()
+{
+}
+
+void FrameLatencyMonitor::Start()
+{
+    if (running_ == true || qApp == nullptr)
+    {
+        return;
+    }
+
+    Q_ASSERT(QThread::currentThread() == qApp->thread());
+
+    QAbstractEventDispatcher* dispatcher = QAbstractEventDispatcher::instance(qApp->thread());
+    if (dispatcher == nullptr)
+    {
+        return;
+    }
+
+    awake_connection_          = connect(dispatcher, &QAbstractEventDispatcher::awake, this, &FrameLatencyMonitor::OnAwake);
+    about_to_block_connection_ = connect(dispatcher, &QAbstractEventDispatcher::aboutToBlock, this, &FrameLatencyMonitor::OnAboutToBlock);
+    qApp->installEventFilter(this);
+
+    wake_ns_          = clock_.nsecsElapsed();
+    idle_ns_          = -1;
+    pending_input_ns_ = -1;
+    painted_          = false;
+    running_          = true;
+
+    report_timer_.start();
+}
+
+void FrameLatencyMonitor::Stop()
+{
+    if (running_ == false)
+    {
+        return;
+    }
+
+    report_timer_.stop();
+
+    if (qApp != nullptr)
+    {
+        qApp->removeEventFilter(this);
+    }
+
+    disconnect(awake_connection_);
+    disconnect(about_to_block_connection_);
+    running_ = false;
+}
+
+bool FrameLatencyMonitor::IsRunning() const
+{
+    return running_;
+}
+
+void FrameLatencyMonitor::Register(QWidget* widget)
+{
+    if (widget == nullptr || monitored_objects_.contains(widget) == true)
+    {
+        return;
+    }
+
+    monitored_objects_.insert(widget, connect(widget, &QObject::destroyed, this, [this, widget]() { monitored_objects_.remove(widget); }));
+
+    // Scroll areas paint into their viewport, so that is where the paint events go.
+    QAbstractScrollArea* scroll_area = qobject_cast<QAbstractScrollArea*>(widget);
+    if (scroll_area != nullptr && scroll_area->viewport() != nullptr)
+    {
+        Register(scroll_area->viewport());
+    }
+}
+
+void FrameLatencyMonitor::Unregister(QWidget* widget)
+{
+    const auto monitored_object = monitored_objects_.constFind(widget);
+    if (monitored_object == monitored_objects_.constEnd())
+    {
+        return;
+    }
+
+    disconnect(monitored_object.value());
+    monitored_objects_.erase(monitored_object);
+
+    QAbstractScrollArea* scroll_area = qobject_cast<QAbstractScrollArea*>(widget);
+    if (scroll_area != nullptr && scroll_area->viewport() != nullptr)
+    {
+        Unregister(scroll_area->viewport());
+    }
+}
+
+void FrameLatencyMonitor::SetTargetFrameRate(double frames_per_second)
+{
+    if (frames_per_second > 0.0)
+    {
+        target_frame_time_us_ = qRound64(1000000.0 / frames_per_second);
+    }
+}
+
+void FrameLatencyMonitor::SetReportInterval(int interval_ms)
+{
+    report_timer_.setInterval(std::max(interval_ms, 1));
+}
+
+const LatencyHistogram& FrameLatencyMonitor::FrameTimes() const
+{
+    return frame_times_;
+}
+
+const LatencyHistogram& FrameLatencyMonitor::InputLatencies() const
+{
+    return input_latencies_;
+}
+
+void FrameLatencyMonitor::Reset()
+{
+    frame_times_.Reset();
+    input_latencies_.Reset();
+    slow_frame_count_ = 0;
+}
+
+bool FrameLatencyMonitor::IsMonitored(QObject* object) const
+{
+    if (monitored_objects_.isEmpty() == true)
+    {
+        return object->isWidgetType();
+    }
+
+    return monitored_objects_.contains(object);
+}
+
+bool FrameLatencyMonitor::eventFilter(QObject* object, QEvent* event)
+{
+    switch (event->type())
+    {
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonRelease:
+    case QEvent::MouseButtonDblClick:
+    case QEvent::MouseMove:
+    case QEvent::Wheel:
+    case QEvent::KeyPress:
+    case QEvent::KeyRelease:
+    case QEvent::TouchBegin:
+    case QEvent::TouchUpdate:
+        // Only the first input since the last frame is timed; the events that follow it
+        // are answered by the same frame.
+        if (pending_input_ns_ < 0)
+        {
+            pending_input_ns_ = clock_.nsecsElapsed();
+        }
+        break;
+
+    case QEvent::Paint:
+        if (painted_ == false && IsMonitored(object) == true)
+        {
+            painted_ = true;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+void FrameLatencyMonitor::OnAwake()
+{
+    // Some dispatchers report waking for every event they process, so only the first
+    // wake after going idle starts a frame.
+    if (idle_ns_ < 0)
+    {
+        return;
+    }
+
+    const qint64 now_ns = clock_.nsecsElapsed();
+
+    // An input that didn't lead to a paint before the event loop went idle, and that
+    // nothing woke the loop up for within a frame, didn't change anything on screen.
+    // A shorter wait may be an update held back until the next vertical refresh.
+    if (pending_input_ns_ >= 0 && (now_ns - idle_ns_) > (target_frame_time_us_ * 1000))
+    {
+        pending_input_ns_ = -1;
+    }
+
+    wake_ns_ = now_ns;
+    idle_ns_ = -1;
+    painted_ = false;
+}
+
+void FrameLatencyMonitor::OnAboutToBlock()
+{
+    const qint64 now_ns = clock_.nsecsElapsed();
+
+    if (painted_ == true)
+    {
+        const qint64 frame_time_us = (now_ns - wake_ns_) / 1000;
+        frame_times_.Record(frame_time_us);
+        if (frame_time_us > target_frame_time_us_)
+        {
+            slow_frame_count_++;
+        }
+
+        QTCOMMON_PROFILE_COUNTER("FrameTimeUs", frame_time_us);
+
+        if (pending_input_ns_ >= 0)
+        {
+            const qint64 input_latency_us = (now_ns - pending_input_ns_) / 1000;
+            input_latencies_.Record(input_latency_us);
+            pending_input_ns_ = -1;
+
+            QTCOMMON_PROFILE_COUNTER("InputLatencyUs", input_latency_us);
+        }
+
+        painted_ = false;
+    }
+
+    idle_ns_ = now_ns;
+}
+
+void FrameLatencyMonitor::Report()
+{
+    if (frame_times_.Count() == 0)
+    {
+        input_latencies_.Reset();
+        return;
+    }
+
+    FrameLatencyStatistics statistics;
+    statistics.frame_count          = frame_times_.Count();
+    statistics.slow_frame_count     = slow_frame_count_;
+    statistics.frame_time_p50_ms    = frame_times_.Percentile(50.0) / 1000.0;
+    statistics.frame_time_p90_ms    = frame_times_.Percentile(90.0) / 1000.0;
+    statistics.frame_time_p99_ms    = frame_times_.Percentile(99.0) / 1000.0;
+    statistics.frame_time_max_ms    = frame_times_.Max() / 1000.0;
+    statistics.input_count          = input_latencies_.Count();
+    statistics.input_latency_p50_ms = input_latencies_.Percentile(50.0) / 1000.0;
+    statistics.input_latency_p90_ms = input_latencies_.Percentile(90.0) / 1000.0;
+    statistics.input_latency_p99_ms = input_latencies_.Percentile(99.0) / 1000.0;
+    statistics.input_latency_max_ms = input_latencies_.Max() / 1000.0;
+
+    const qint64 frame_time_p90_us = frame_times_.Percentile(90.0);
+
+    Reset();
+
+    emit StatisticsUpdated(statistics);
+
+    if (frame_time_p90_us > target_frame_time_us_)
+    {
+        emit FrameRateBelowTarget(1000000.0 / frame_time_p90_us, statistics);
+    }
+}
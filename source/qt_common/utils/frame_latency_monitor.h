@@ -0,0 +1,192 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for the FrameLatencyMonitor.
+//=============================================================================
+
+#ifndef QTCOMMON_UTILS_FRAME_LATENCY_MONITOR_H_
+#define QTCOMMON_UTILS_FRAME_LATENCY_MONITOR_H_
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMetaObject>
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+
+class QWidget;
+
+/// Histogram of durations with a bounded relative error, in the style of HdrHistogram.
+///
+/// Values are bucketed by their power of two, and each power of two is split into
+/// linear sub-buckets, so every recorded value is reported to within about 1.6%
+/// regardless of its magnitude, in a fixed amount of memory.
+class LatencyHistogram
+{
+public:
+    /// Constructor.
+    LatencyHistogram();
+
+    /// Record a value.
+    /// \param value_us The value, in microseconds. Negative values are recorded as 0.
+    void Record(qint64 value_us);
+
+    /// Discard all recorded values.
+    void Reset();
+
+    /// Get the number of recorded values.
+    /// \return The value count.
+    quint64 Count() const;
+
+    /// Get the largest recorded value.
+    /// \return The maximum, in microseconds, or 0 if nothing was recorded.
+    qint64 Max() const;
+
+    /// Get a percentile of the recorded values.
+    /// \param percentile The percentile, from 0 to 100.
+    /// \return The highest value equivalent to the percentile, in microseconds, or 0 if nothing was recorded.
+    qint64 Percentile(double percentile) const;
+
+private:
+    /// Get the bucket a value is counted in.
+    /// \param value_us The value, in microseconds.
+    /// \return The bucket index.
+    static int BucketIndex(qint64 value_us);
+
+    /// Get the highest value counted in a bucket.
+    /// \param index The bucket index.
+    /// \return The value, in microseconds.
+    static qint64 BucketUpperBound(int index);
+
+    QVector<quint64> counts_;  ///< The number of values in each bucket.
+    quint64          count_;   ///< The total number of values.
+    qint64           max_;     ///< The largest recorded value.
+};
+
+/// Frame and input latency percentiles over one reporting interval.
+struct FrameLatencyStatistics
+{
+    quint64 frame_count;           ///< The number of frames painted.
+    quint64 slow_frame_count;      ///< The number of frames that took longer than the target frame time.
+    double  frame_time_p50_ms;     ///< The median frame time.
+    double  frame_time_p90_ms;     ///< The 90th percentile frame time.
+    double  frame_time_p99_ms;     ///< The 99th percentile frame time.
+    double  frame_time_max_ms;     ///< The longest frame time.
+    quint64 input_count;           ///< The number of inputs followed by a paint.
+    double  input_latency_p50_ms;  ///< The median time from input to the end of the following paint.
+    double  input_latency_p90_ms;  ///< The 90th percentile input latency.
+    double  input_latency_p99_ms;  ///< The 99th percentile input latency.
+    double  input_latency_max_ms;  ///< The longest input latency.
+};
+
+/// Class that measures frame times and input-to-paint latency on the GUI thread.
+///
+/// A frame is one pass of the event loop, from waking up to going idle again, in which
+/// a monitored widget was painted. Input latency is the time from the first input event
+/// after the previous frame to the end of the next frame. The durations are collected
+/// in histograms and reported as percentiles at a regular interval, and a separate
+/// signal is emitted when frames are slower than the target frame rate.
+class FrameLatencyMonitor : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// FrameLatencyMonitor instance get function.
+    /// \return a reference to the FrameLatencyMonitor instance.
+    static FrameLatencyMonitor& Get();
+
+    /// Start monitoring the GUI thread's event loop. Must be called on the GUI thread
+    /// once the application object exists.
+    void Start();
+
+    /// Stop monitoring. Recorded values are kept until the next report or Reset().
+    void Stop();
+
+    /// Check whether the monitor is running.
+    /// \return true if the monitor is running, false otherwise.
+    bool IsRunning() const;
+
+    /// Monitor the paint events of a widget. If no widgets are registered, painting any
+    /// widget counts as a frame. The widget is unregistered automatically when it is destroyed.
+    /// \param widget The widget. For scroll areas, the viewport is monitored as well.
+    void Register(QWidget* widget);
+
+    /// Stop monitoring the paint events of a widget.
+    /// \param widget The widget.
+    void Unregister(QWidget* widget);
+
+    /// Set the frame rate below which FrameRateBelowTarget is emitted. Defaults to 60.
+    /// \param frames_per_second The target frame rate.
+    void SetTargetFrameRate(double frames_per_second);
+
+    /// Set how often StatisticsUpdated is emitted. Defaults to 1000 ms.
+    /// \param interval_ms The reporting interval, in milliseconds.
+    void SetReportInterval(int interval_ms);
+
+    /// Get the frame times recorded since the last report.
+    /// \return The frame time histogram, in microseconds.
+    const LatencyHistogram& FrameTimes() const;
+
+    /// Get the input latencies recorded since the last report.
+    /// \return The input latency histogram, in microseconds.
+    const LatencyHistogram& InputLatencies() const;
+
+    /// Discard all recorded values.
+    void Reset();
+
+signals:
+    /// Emitted at the end of each reporting interval in which frames were painted.
+    /// \param statistics The percentiles for the interval.
+    void StatisticsUpdated(const FrameLatencyStatistics& statistics);
+
+    /// Emitted with StatisticsUpdated when the 90th percentile frame time is longer than
+    /// the target frame time.
+    /// \param frames_per_second The frame rate implied by the 90th percentile frame time.
+    /// \param statistics The percentiles for the interval.
+    void FrameRateBelowTarget(double frames_per_second, const FrameLatencyStatistics& statistics);
+
+protected:
+    /// Overridden event filter. Watches input events and paint events of monitored widgets.
+    /// \param object The object receiving the event.
+    /// \param event The event.
+    /// \return Always false, so that the event is processed as normal.
+    virtual bool eventFilter(QObject* object, QEvent* event) Q_DECL_OVERRIDE;
+
+private slots:
+    /// Called when the event loop wakes up.
+    void OnAwake();
+
+    /// Called when the event loop is about to wait for events.
+    void OnAboutToBlock();
+
+    /// Emit the statistics for the current interval and start a new one.
+    void Report();
+
+private:
+    /// Constructor/destructor is private for singleton
+    FrameLatencyMonitor();
+    ~FrameLatencyMonitor();
+
+    /// Check whether paint events sent to an object count towards a frame.
+    /// \param object The object.
+    /// \return true if the object is monitored, false otherwise.
+    bool IsMonitored(QObject* object) const;
+
+    QElapsedTimer                            clock_;                      ///< The time base for all measurements.
+    QTimer                                   report_timer_;               ///< Triggers the periodic reports.
+    QMetaObject::Connection                  awake_connection_;           ///< Connection to the event dispatcher's awake signal.
+    QMetaObject::Connection                  about_to_block_connection_;  ///< Connection to the event dispatcher's aboutToBlock signal.
+    QHash<QObject*, QMetaObject::Connection> monitored_objects_;          ///< Monitored widgets and their destroyed connections.
+    LatencyHistogram                         frame_times_;                ///< Frame times since the last report.
+    LatencyHistogram                         input_latencies_;            ///< Input latencies since the last report.
+    quint64                                  slow_frame_count_;           ///< Frames longer than the target since the last report.
+    qint64                                   target_frame_time_us_;       ///< The longest frame time that meets the target frame rate.
+    qint64                                   wake_ns_;                    ///< When the event loop last woke up.
+    qint64                                   idle_ns_;                    ///< When the event loop last went idle, or -1 if it's busy.
+    qint64                                   pending_input_ns_;           ///< When the first unanswered input arrived, or -1 if there is none.
+    bool                                     painted_;                    ///< Whether a monitored widget was painted since the event loop woke up.
+    bool                                     running_;                    ///< Whether the monitor is running.
+};
+
+#endif  // QTCOMMON_UTILS_FRAME_LATENCY_MONITOR_H_
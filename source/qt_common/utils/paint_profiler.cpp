@@ -0,0 +1,338 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of the paint and update profiler.
+//=============================================================================
+
+#include "paint_profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QThread>
+#include <QVector>
+
+/// The number of events kept per thread.
+static const quint64 kRingBufferCapacity = 8192;
+
+namespace
+{
+    /// A recorded event.
+    struct ProfilerEvent
+    {
+        const char* name;          ///< The name of the event.
+        qint64      timestamp_ns;  ///< The start time of a scope, or the time a counter was recorded.
+        qint64      value;         ///< The duration of a scope, or the value of a counter.
+        bool        is_counter;    ///< Whether this is a counter rather than a scope.
+    };
+
+    /// The storage for one event in a ring buffer. The fields are atomic so that a reader can copy a slot
+    /// while the owning thread overwrites it; the reader then discards the copy, see ToChromeTraceJson().
+    struct ProfilerEventSlot
+    {
+        std::atomic<const char*> name;          ///< The name of the event.
+        std::atomic<qint64>      timestamp_ns;  ///< The start time of a scope, or the time a counter was recorded.
+        std::atomic<qint64>      value;         ///< The duration of a scope, or the value of a counter.
+        std::atomic<bool>        is_counter;    ///< Whether this is a counter rather than a scope.
+    };
+
+    /// A thread that wrote to a ring buffer.
+    struct RingBufferOwner
+    {
+        quint64 first_sequence;  ///< The sequence number of the first event the thread wrote.
+        int     thread_index;    ///< Identifies the thread in the trace.
+        QString thread_name;     ///< The name of the thread when it started recording.
+    };
+
+    /// The events recorded by one thread at a time. Only the owning thread writes events.
+    struct RingBuffer
+    {
+        ProfilerEventSlot        events[kRingBufferCapacity];  ///< The events, indexed by sequence number modulo the capacity.
+        std::atomic<quint64>     head;                         ///< The sequence number of the next event to write.
+        quint64                  tail;                         ///< Events before this sequence number were cleared. Guarded by the registry mutex.
+        QVector<RingBufferOwner> owners;                       ///< The threads that wrote the retained events, oldest first. Guarded by the registry mutex.
+    };
+
+    /// All ring buffers. A buffer outlives the thread that wrote it, and is reused by the next new thread.
+    struct Registry
+    {
+        /// Constructor.
+        Registry()
+            : next_thread_index(1)
+        {
+        }
+
+        QMutex                               mutex;              ///< Guards the buffer lists and the buffer tails and owners.
+        QVector<std::shared_ptr<RingBuffer>> buffers;            ///< All ring buffers.
+        QVector<std::shared_ptr<RingBuffer>> free_buffers;       ///< The ring buffers of threads that have exited.
+        int                                  next_thread_index;  ///< The trace index of the next thread to record.
+    };
+
+    /// Returns the calling thread's ring buffer to the registry when the thread exits.
+    struct ThreadRingBuffer
+    {
+        /// Destructor. Makes the buffer available to new threads. Its events are kept until then.
+        ~ThreadRingBuffer();
+
+        std::shared_ptr<RingBuffer> buffer;  ///< The calling thread's ring buffer, or nullptr if it hasn't recorded yet.
+    };
+
+    /// Whether events are recorded.
+    std::atomic<bool> profiler_enabled(true);
+
+    /// Get the ring buffer registry.
+    /// \return The registry.
+    Registry& GetRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    /// Get the oldest sequence number of a ring buffer that can still be read.
+    /// \param buffer The ring buffer. Must be called with the registry mutex held.
+    /// \param head The head of the ring buffer.
+    /// \return The sequence number.
+    quint64 OldestSequence(const RingBuffer& buffer, quint64 head)
+    {
+        // The owning thread may be overwriting the slot at head - capacity, since it writes that slot
+        // before it publishes head + 1.
+        return std::max(buffer.tail, (head >= kRingBufferCapacity) ? (head + 1 - kRingBufferCapacity) : 0);
+    }
+
+    /// Forget the owners of a ring buffer whose events are all gone.
+    /// \param buffer The ring buffer. Must be called with the registry mutex held.
+    void PruneOwners(RingBuffer& buffer)
+    {
+        const quint64 oldest_sequence = OldestSequence(buffer, buffer.head.load(std::memory_order_acquire));
+        while (buffer.owners.size() > 1 && buffer.owners[1].first_sequence <= oldest_sequence)
+        {
+            buffer.owners.removeFirst();
+        }
+    }
+
+    ThreadRingBuffer::~ThreadRingBuffer()
+    {
+        if (buffer != nullptr)
+        {
+            Registry&    registry = GetRegistry();
+            QMutexLocker locker(&registry.mutex);
+            registry.free_buffers.append(buffer);
+        }
+    }
+
+    /// Get the calling thread's ring buffer, taking a free one or creating one on first use.
+    /// \return The ring buffer.
+    RingBuffer& GetThreadRingBuffer()
+    {
+        thread_local ThreadRingBuffer thread_buffer;
+
+        if (thread_buffer.buffer == nullptr)
+        {
+            Registry&    registry = GetRegistry();
+            QMutexLocker locker(&registry.mutex);
+
+            std::shared_ptr<RingBuffer> buffer;
+            if (registry.free_buffers.isEmpty() == false)
+            {
+                buffer = registry.free_buffers.takeLast();
+            }
+            else
+            {
+                buffer = std::make_shared<RingBuffer>();
+                buffer->head.store(0);
+                buffer->tail = 0;
+                registry.buffers.append(buffer);
+            }
+
+            RingBufferOwner owner;
+            owner.first_sequence = buffer->head.load(std::memory_order_relaxed);
+            owner.thread_index   = registry.next_thread_index++;
+            owner.thread_name    = (QThread::currentThread() != nullptr) ? QThread::currentThread()->objectName() : QString();
+            buffer->owners.append(owner);
+            PruneOwners(*buffer);
+
+            thread_buffer.buffer = buffer;
+        }
+
+        return *thread_buffer.buffer;
+    }
+
+    /// Append an event to the calling thread's ring buffer.
+    /// \param event The event.
+    void RecordEvent(const ProfilerEvent& event)
+    {
+        RingBuffer&        buffer   = GetThreadRingBuffer();
+        const quint64      sequence = buffer.head.load(std::memory_order_relaxed);
+        ProfilerEventSlot& slot     = buffer.events[sequence % kRingBufferCapacity];
+
+        // Pairs with the fence in ToChromeTraceJson(): a reader that sees any of the new field values also
+        // sees a head of at least this sequence number, and so discards its copy of the slot.
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.name.store(event.name, std::memory_order_relaxed);
+        slot.timestamp_ns.store(event.timestamp_ns, std::memory_order_relaxed);
+        slot.value.store(event.value, std::memory_order_relaxed);
+        slot.is_counter.store(event.is_counter, std::memory_order_relaxed);
+        buffer.head.store(sequence + 1, std::memory_order_release);
+    }
+}  // namespace
+
+PaintProfiler::ScopedTimer::ScopedTimer(const char* name)
+    : name_(IsEnabled() ? name : nullptr)
+    , start_ns_(name_ != nullptr ? Now() : 0)
+{
+}
+
+PaintProfiler::ScopedTimer::~ScopedTimer()
+{
+    if (name_ != nullptr)
+    {
+        RecordScope(name_, start_ns_, Now() - start_ns_);
+    }
+}
+
+void PaintProfiler::SetEnabled(bool enabled)
+{
+    profiler_enabled.store(enabled);
+}
+
+bool PaintProfiler::IsEnabled()
+{
+    return profiler_enabled.load(std::memory_order_relaxed);
+}
+
+void PaintProfiler::RecordScope(const char* name, qint64 start_ns, qint64 duration_ns)
+{
+    RecordEvent({name, start_ns, duration_ns, false});
+}
+
+void PaintProfiler::RecordCounter(const char* name, qint64 value)
+{
+    if (IsEnabled() == true)
+    {
+        RecordEvent({name, Now(), value, true});
+    }
+}
+
+qint64 PaintProfiler::Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void PaintProfiler::Clear()
+{
+    Registry&    registry = GetRegistry();
+    QMutexLocker locker(&registry.mutex);
+
+    for (const std::shared_ptr<RingBuffer>& buffer : registry.buffers)
+    {
+        buffer->tail = buffer->head.load(std::memory_order_acquire);
+        PruneOwners(*buffer);
+    }
+}
+
+QByteArray PaintProfiler::ToChromeTraceJson()
+{
+    QJsonArray trace_events;
+
+    Registry&    registry = GetRegistry();
+    QMutexLocker locker(&registry.mutex);
+
+    for (const std::shared_ptr<RingBuffer>& buffer : registry.buffers)
+    {
+        // Copy the events first, since the owning thread may keep writing.
+        const quint64          head  = buffer->head.load(std::memory_order_acquire);
+        const quint64          first = OldestSequence(*buffer, head);
+        QVector<ProfilerEvent> events;
+        events.reserve((int)(head - first));
+        for (quint64 sequence = first; sequence < head; sequence++)
+        {
+            const ProfilerEventSlot& slot = buffer->events[sequence % kRingBufferCapacity];
+            events.append({slot.name.load(std::memory_order_relaxed),
+                           slot.timestamp_ns.load(std::memory_order_relaxed),
+                           slot.value.load(std::memory_order_relaxed),
+                           slot.is_counter.load(std::memory_order_relaxed)});
+        }
+
+        // Drop any events that were overwritten while being copied. The fence makes any overwrite that the
+        // copy saw also visible in the head, see RecordEvent().
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const quint64 valid_first = OldestSequence(*buffer, buffer->head.load(std::memory_order_relaxed));
+        const int     overwritten = (int)std::min<quint64>(events.size(), (valid_first > first) ? (valid_first - first) : 0);
+        events.remove(0, overwritten);
+
+        for (const RingBufferOwner& owner : buffer->owners)
+        {
+            QJsonObject thread_name_args;
+            thread_name_args["name"] = owner.thread_name.isEmpty() ? QString("Thread %1").arg(owner.thread_index) : owner.thread_name;
+
+            QJsonObject thread_name_event;
+            thread_name_event["name"] = "thread_name";
+            thread_name_event["ph"]   = "M";
+            thread_name_event["pid"]  = 1;
+            thread_name_event["tid"]  = owner.thread_index;
+            thread_name_event["args"] = thread_name_args;
+            trace_events.append(thread_name_event);
+        }
+
+        // Each event belongs to the last owner that started recording at or before it.
+        int owner_index = 0;
+        for (int i = 0; i < events.size(); i++)
+        {
+            const ProfilerEvent& event    = events[i];
+            const quint64        sequence = first + overwritten + i;
+            while (owner_index + 1 < buffer->owners.size() && buffer->owners[owner_index + 1].first_sequence <= sequence)
+            {
+                owner_index++;
+            }
+
+            // Trace event times are in microseconds.
+            QJsonObject trace_event;
+            trace_event["name"] = QString::fromLatin1(event.name);
+            trace_event["pid"]  = 1;
+            trace_event["tid"]  = buffer->owners[owner_index].thread_index;
+            trace_event["ts"]   = event.timestamp_ns / 1000.0;
+
+            if (event.is_counter == true)
+            {
+                QJsonObject counter_args;
+                counter_args["value"] = event.value;
+
+                trace_event["ph"]   = "C";
+                trace_event["args"] = counter_args;
+            }
+            else
+            {
+                trace_event["ph"]  = "X";
+                trace_event["dur"] = event.value / 1000.0;
+            }
+
+            trace_events.append(trace_event);
+        }
+    }
+
+    QJsonObject root;
+    root["traceEvents"]     = trace_events;
+    root["displayTimeUnit"] = "ns";
+    return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+bool PaintProfiler::WriteChromeTrace(const QString& file_path)
+{
+    QFile file(file_path);
+    if (file.open(QIODevice::WriteOnly | QIODevice::Truncate) == false)
+    {
+        return false;
+    }
+
+    const QByteArray json = ToChromeTraceJson();
+    return file.write(json) == json.size();
+}
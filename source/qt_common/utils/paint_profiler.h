@@ -0,0 +1,95 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for the paint and update profiler.
+//=============================================================================
+
+#ifndef QTCOMMON_UTILS_PAINT_PROFILER_H_
+#define QTCOMMON_UTILS_PAINT_PROFILER_H_
+
+#include <QByteArray>
+#include <QString>
+
+/// Class that records how long widget paint and update paths take.
+///
+/// Events are written to a fixed-size ring buffer owned by the recording thread, so
+/// recording takes no locks; once a buffer is full, the oldest events are overwritten.
+/// When a thread exits, its buffer keeps its events and is handed to the next thread that
+/// starts recording, so the number of buffers is bounded by the peak number of threads
+/// recording at once rather than growing as thread pools retire and replace threads.
+/// The recorded events can be written out in the Chrome trace event format, to be
+/// viewed in chrome://tracing or Perfetto.
+///
+/// The instrumentation macros below only record anything when the library is built
+/// with the QTCOMMON_ENABLE_PAINT_PROFILING CMake option.
+class PaintProfiler
+{
+public:
+    /// Records the time between its construction and destruction as a trace event.
+    class ScopedTimer
+    {
+    public:
+        /// Constructor. Starts timing.
+        /// \param name The name of the event. Must be a string with static storage, such as a literal.
+        explicit ScopedTimer(const char* name);
+
+        /// Destructor. Records the event.
+        ~ScopedTimer();
+
+    private:
+        const char* name_;      ///< The name of the event, or nullptr if profiling was disabled at construction.
+        qint64      start_ns_;  ///< The start time, in nanoseconds.
+    };
+
+    /// Enable or disable recording at runtime. Recording is enabled by default.
+    /// \param enabled Whether to record events.
+    static void SetEnabled(bool enabled);
+
+    /// Check whether events are being recorded.
+    /// \return true if recording is enabled, false otherwise.
+    static bool IsEnabled();
+
+    /// Record a completed scope on the calling thread.
+    /// \param name The name of the event. Must be a string with static storage, such as a literal.
+    /// \param start_ns The start time, as returned by Now().
+    /// \param duration_ns The duration, in nanoseconds.
+    static void RecordScope(const char* name, qint64 start_ns, qint64 duration_ns);
+
+    /// Record the value of a counter on the calling thread.
+    /// \param name The name of the counter. Must be a string with static storage, such as a literal.
+    /// \param value The counter value.
+    static void RecordCounter(const char* name, qint64 value);
+
+    /// Get the current time on the profiler's clock.
+    /// \return The time, in nanoseconds.
+    static qint64 Now();
+
+    /// Discard all recorded events.
+    static void Clear();
+
+    /// Get all recorded events in the Chrome trace event format.
+    /// \return The JSON text.
+    static QByteArray ToChromeTraceJson();
+
+    /// Write all recorded events to a file in the Chrome trace event format.
+    /// \param file_path The path of the file to write.
+    /// \return true if the file was written, false otherwise.
+    static bool WriteChromeTrace(const QString& file_path);
+};
+
+#define QTCOMMON_PROFILE_CONCAT_INNER(a, b) a##b
+#define QTCOMMON_PROFILE_CONCAT(a, b) QTCOMMON_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef QTCOMMON_ENABLE_PAINT_PROFILING
+/// Time the rest of the enclosing scope.
+#define QTCOMMON_PROFILE_SCOPE(name) PaintProfiler::ScopedTimer QTCOMMON_PROFILE_CONCAT(paint_profiler_scope_, __LINE__)(name)
+
+/// Record the value of a counter.
+#define QTCOMMON_PROFILE_COUNTER(name, value) PaintProfiler::RecordCounter(name, value)
+#else
+#define QTCOMMON_PROFILE_SCOPE(name)
+#define QTCOMMON_PROFILE_COUNTER(name, value)
+#endif  // QTCOMMON_ENABLE_PAINT_PROFILING
+
+#endif  // QTCOMMON_UTILS_PAINT_PROFILER_H_
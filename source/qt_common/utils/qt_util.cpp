@@ -7,6 +7,7 @@
 
 #include "qt_util.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <QApplication>
@@ -18,12 +19,16 @@
 #include <QHeaderView>
 #include <QProcess>
 #include <QSettings>
+#include <QtAlgorithms>
 #include <QStyleHints>
 #include <QTextStream>
 #include <QUrl>
 
+#include "column_width_engine.h"
 #include "common_definitions.h"
 #include "scaling_manager.h"
+#include "style_sheet_registry.h"
+#include "text_width_cache.h"
 
 #ifdef Q_OS_WIN
 #ifndef NOMINMAX
@@ -45,6 +50,347 @@ using fnSetWindowCompositionAttribute = BOOL(WINAPI*)(HWND hwnd, WindowCompositi
 
 #endif  // Q_OS_WIN
 
+/// The largest clock formatted with integer arithmetic. Up to this value, dividing the clock as a
+/// double truncates and rounds to the same digits as dividing it as an integer.
+static const double kMaxIntegerFormatClock = 1125899906842624.0;
+
+/// Helper that appends characters to a fixed-capacity buffer, counting any overflow.
+class FixedBufferWriter
+{
+public:
+    /// Constructor.
+    /// \param buffer The buffer to write to.
+    /// \param buffer_size The capacity of the buffer.
+    FixedBufferWriter(QChar* buffer, int buffer_size)
+        : buffer_(buffer)
+        , buffer_size_(buffer_size)
+        , length_(0)
+    {
+    }
+
+    /// Append a character.
+    /// \param character The character.
+    void Append(QChar character)
+    {
+        if (length_ < buffer_size_)
+        {
+            buffer_[length_] = character;
+        }
+
+        length_++;
+    }
+
+    /// Append a Latin-1 string.
+    /// \param text The null-terminated string.
+    void Append(const char* text)
+    {
+        for (; *text != '\0'; text++)
+        {
+            Append(QLatin1Char(*text));
+        }
+    }
+
+    /// Append a string.
+    /// \param text The string.
+    void Append(const QString& text)
+    {
+        for (const QChar character : text)
+        {
+            Append(character);
+        }
+    }
+
+    /// Append an unsigned number, zero-padded to a minimum number of digits.
+    /// \param value The number.
+    /// \param min_digits The minimum number of digits.
+    /// \param group_digits Whether to separate each group of three digits with a comma.
+    void AppendNumber(quint64 value, int min_digits, bool group_digits)
+    {
+        char digits[32];
+        int  digit_count = 0;
+        do
+        {
+            digits[digit_count++] = (char)('0' + (value % 10));
+            value /= 10;
+        } while (value != 0 || digit_count < min_digits);
+
+        for (int i = digit_count - 1; i >= 0; i--)
+        {
+            Append(QLatin1Char(digits[i]));
+            if (group_digits == true && i > 0 && (i % 3) == 0)
+            {
+                Append(QLatin1Char(','));
+            }
+        }
+    }
+
+    /// Get the number of characters appended, including any that did not fit.
+    /// \return The length.
+    int Length() const
+    {
+        return length_;
+    }
+
+private:
+    QChar* buffer_;       ///< The buffer to write to.
+    int    buffer_size_;  ///< The capacity of the buffer.
+    int    length_;       ///< The number of characters appended.
+};
+
+/// Convert an integral clock to a time unit using integer arithmetic. Numbers printed through
+/// the text stream are grouped, as the English locale does.
+/// \param clk input clock to convert
+/// \param unit_type unit type
+/// \param writer Receives the characters.
+/// \return true if the clock was formatted, false if it needs the text stream to round identically.
+static bool FormatIntegerClock(quint64 clk, int unit_type, FixedBufferWriter& writer)
+{
+    switch (unit_type)
+    {
+    case kTimeUnitTypeNanosecond:
+        writer.AppendNumber(clk, 1, true);
+        writer.Append(" ns");
+        break;
+
+    case kTimeUnitTypeMicrosecond:
+        writer.AppendNumber(clk / 1000, 1, true);
+        writer.Append(QLatin1Char('.'));
+        writer.AppendNumber(clk % 1000, 3, false);
+        writer.Append(QLatin1Char(' '));
+        writer.Append(QChar(0x03bc));
+        writer.Append(QLatin1Char('s'));
+        break;
+
+    case kTimeUnitTypeMillisecond:
+    {
+        // Rounding halfway cases depends on how the quotient was rounded to a double.
+        if ((clk % 1000) == 500)
+        {
+            return false;
+        }
+
+        const quint64 microseconds = (clk + 500) / 1000;
+        writer.AppendNumber(microseconds / 1000, 1, true);
+        writer.Append(QLatin1Char('.'));
+        writer.AppendNumber(microseconds % 1000, 3, false);
+        writer.Append(" ms");
+    }
+    break;
+
+    case kTimeUnitTypeSecond:
+        writer.AppendNumber(clk / 1000000000, 2, false);
+        writer.Append(QLatin1Char('.'));
+        writer.AppendNumber((clk / 10000000) % 100, 2, false);
+        writer.Append(QLatin1Char('s'));
+        break;
+
+    case kTimeUnitTypeMinute:
+        writer.AppendNumber(clk / 60000000000, 1, true);
+        writer.Append("m ");
+        writer.AppendNumber((clk / 1000000000) % 60, 2, false);
+        writer.Append(QLatin1Char('.'));
+        writer.AppendNumber((clk / 10000000) % 100, 2, false);
+        writer.Append(QLatin1Char('s'));
+        break;
+
+    case kTimeUnitTypeHour:
+    {
+        writer.AppendNumber(clk / 3600000000000, 1, true);
+        writer.Append(QLatin1Char(':'));
+        writer.AppendNumber((clk / 60000000000) % 60, 2, false);
+        writer.Append(QLatin1Char(':'));
+        writer.AppendNumber((clk / 1000000000) % 60, 2, false);
+        writer.Append(QLatin1Char('.'));
+
+        // The fraction is left-justified, so trailing zeros are added rather than leading ones.
+        const quint64 fraction     = (clk / 10000) % 100000;
+        const int     start_length = writer.Length();
+        writer.AppendNumber(fraction, 1, false);
+        for (int i = writer.Length() - start_length; i < 5; i++)
+        {
+            writer.Append(QLatin1Char('0'));
+        }
+    }
+    break;
+
+    case kTimeUnitTypeClk:
+    default:
+        writer.AppendNumber(clk, 1, true);
+        writer.Append(" clk");
+        break;
+    }
+
+    return true;
+}
+
+/// The file size unit acronyms, indexed by the power of 1024 of the unit.
+static constexpr const char* kSizeAcronyms[] = {" B", " KB", " MB", " GB", " TB", " PB"};
+
+/// The number of file size units.
+static constexpr int kSizeAcronymCount = sizeof(kSizeAcronyms) / sizeof(kSizeAcronyms[0]);
+
+/// Get the largest file size unit not exceeding a byte count, from the number of significant bits.
+/// \param byte_count The number of bytes.
+/// \return The index of the unit in kSizeAcronyms.
+static int FilesizeAcronymIndex(quint64 byte_count)
+{
+    if (byte_count == 0)
+    {
+        return 0;
+    }
+
+    const int bit_width = 64 - (int)qCountLeadingZeroBits(byte_count);
+    return std::min((bit_width - 1) / 10, kSizeAcronymCount - 1);
+}
+
+/// Format a byte count scaled down by a power of two, the same way QString::number(size, 'g', 4)
+/// would, using integer arithmetic. The scaled size must be below 1024.
+/// \param byte_count The number of bytes, as represented by a double.
+/// \param shift The power of two to scale down by.
+/// \param use_round If true, round the value to the nearest integer.
+/// \param writer Receives the characters.
+/// \return true if the size was formatted, false if it lies exactly halfway between two outputs.
+static bool FormatScaledByteCount(quint64 byte_count, int shift, bool use_round, FixedBufferWriter& writer)
+{
+    const quint64 integer_part = byte_count >> shift;
+    const quint64 remainder    = byte_count - (integer_part << shift);
+    const quint64 half         = (shift > 0) ? (quint64(1) << (shift - 1)) : 0;
+
+    if (use_round == true)
+    {
+        // Halfway cases round away from zero, as round() does.
+        writer.AppendNumber(integer_part + ((shift > 0 && remainder >= half) ? 1 : 0), 1, false);
+        return true;
+    }
+
+    // Keep four significant digits.
+    int decimals = 3;
+    for (quint64 i = integer_part; i >= 10; i /= 10)
+    {
+        decimals--;
+    }
+
+    quint64 scale = 1;
+    for (int i = 0; i < decimals; i++)
+    {
+        scale *= 10;
+    }
+
+    const quint64 fraction = remainder * scale;
+    quint64       digits   = integer_part * scale + (fraction >> shift);
+    if (shift > 0)
+    {
+        const quint64 dropped = fraction - ((fraction >> shift) << shift);
+        if (dropped == half)
+        {
+            return false;
+        }
+
+        if (dropped > half)
+        {
+            digits++;
+        }
+    }
+
+    // Rounding up may carry into a fifth digit, as in 9.9996 becoming 10.00.
+    if (digits == 10000)
+    {
+        digits = 1000;
+        scale /= 10;
+        decimals--;
+    }
+
+    // Trailing zeros are not shown.
+    while (decimals > 0 && (digits % 10) == 0)
+    {
+        digits /= 10;
+        scale /= 10;
+        decimals--;
+    }
+
+    writer.AppendNumber(digits / scale, 1, false);
+    if (decimals > 0)
+    {
+        writer.Append(QLatin1Char('.'));
+        writer.AppendNumber(digits % scale, decimals, false);
+    }
+
+    return true;
+}
+
+/// Convert a clock to a time unit using a text stream. Used for clocks that cannot be
+/// formatted with integer arithmetic.
+/// \param clk input clock to convert
+/// \param unit_type unit type
+/// \return a string representing a clock value
+static QString StreamClockToTimeUnit(double clk, int unit_type)
+{
+    double time = clk;
+
+    QString     str = "";
+    QTextStream out(&str);
+    out.setRealNumberNotation(QTextStream::FixedNotation);
+    out.setLocale(QLocale::English);
+
+    switch (unit_type)
+    {
+    case kTimeUnitTypeNanosecond:
+        out.setRealNumberPrecision(0);
+        out << time << " ns";
+        break;
+
+    case kTimeUnitTypeMicrosecond:
+        time /= 1000.0;
+        out.setRealNumberPrecision(3);
+        out << time << QString(u8" μs");
+        break;
+
+    case kTimeUnitTypeMillisecond:
+        out.setRealNumberPrecision(3);
+        time /= 1000000.0;
+        out << time << " ms";
+        break;
+
+    case kTimeUnitTypeSecond:
+    {
+        out.setRealNumberPrecision(0);
+        uint64_t secs = (uint64_t)(time / 1000000000.0);
+        uint64_t ms   = (uint64_t)fmod((time / 10000000.0), 100);
+        out << QString::number(secs).rightJustified(2, '0') << "." << QString::number(ms).rightJustified(2, '0') << "s";
+    }
+    break;
+
+    case kTimeUnitTypeMinute:
+    {
+        out.setRealNumberPrecision(0);
+        uint64_t mins = (uint64_t)(time / 60000000000.0);
+        uint64_t secs = (uint64_t)fmod((time / 1000000000.0), 60);
+        uint64_t ms   = (uint64_t)fmod((time / 10000000.0), 100);
+        out << mins << "m " << QString::number(secs).rightJustified(2, '0') << "." << QString::number(ms).rightJustified(2, '0') << "s";
+    }
+    break;
+
+    case kTimeUnitTypeHour:
+    {
+        out.setRealNumberPrecision(0);
+        uint64_t hours    = static_cast<uint64_t>(time / (60 * 60 * 1000000000.0));
+        uint64_t mins     = static_cast<uint64_t>(fmod((time / (60 * 1000000000.0)), 60));
+        uint64_t secs     = static_cast<uint64_t>(fmod((time / 1000000000.0), 60));
+        uint64_t fraction = static_cast<uint64_t>(fmod((time / 10000.0), 100000));
+        out << hours << ":" << QString::number(mins).rightJustified(2, '0') << ":" << QString::number(secs).rightJustified(2, '0') << "."
+            << QString::number(fraction).leftJustified(5, '0');
+    }
+    break;
+
+    case kTimeUnitTypeClk:
+    default:
+        out << (quint64)clk << " clk";
+        break;
+    }
+
+    return str;
+}
+
 namespace QtCommon
 {
     void QtUtils::ApplyStandardTableStyle(QTreeView* view)
@@ -72,7 +418,8 @@ namespace QtCommon
             view->setWordWrap(false);
             view->setAlternatingRowColors(true);
 
-            view->setStyleSheet(view->styleSheet() + "QTreeView{paint-alternating-row-colors-for-empty-area: 1; }");
+            // Only append the rule once, so that applying the style again doesn't grow the style sheet.
+            StyleSheetRegistry::Get().AppendRule(view, "QTreeView{paint-alternating-row-colors-for-empty-area: 1; }");
         }
     }
 
@@ -102,13 +449,13 @@ namespace QtCommon
         QHeaderView* header = tree_view->header();
         if (header != nullptr)
         {
-            tree_view->header()->setSectionResizeMode(QHeaderView::ResizeToContents);
-            const int    column_count = tree_view->header()->count();
-            QVector<int> column_widths(column_count);
+            header->setSectionResizeMode(QHeaderView::ResizeToContents);
 
             QAbstractItemModel* model = (QAbstractItemModel*)tree_view->model();
             if (model != nullptr)
             {
+                const QVector<int> column_widths = ColumnWidthEngine::ComputeColumnWidths(model, header, tree_view->font(), max_rows, padding);
+
                 int     margin = 0;
                 QStyle* style  = header->style();
                 if (style != nullptr)
@@ -116,39 +463,11 @@ namespace QtCommon
                     margin = header->style()->pixelMetric(QStyle::PM_HeaderMargin, 0, header);
                 }
 
-                const int    row_count   = model->rowCount();
-                const int    elide_width = QtUtils::GetTextWidth(tree_view->font(), QString(QChar(0x2026)));
                 QFontMetrics fm(header->font());
                 header->setFixedHeight(fm.height() + (margin * 2));
 
-                for (int column = 0; column < column_count; column++)
-                {
-                    const QVariant header_data = model->headerData(column, Qt::Horizontal);
-                    const QString  text_header = header_data.toString().trimmed();
-                    column_widths[column]      = QtUtils::GetTextWidth(header->font(), text_header) + padding + (margin * 2);
-                    for (int row = 0; (row < row_count) && (row < max_rows); row++)
-                    {
-                        const QString textData = model->data(model->index(row, column)).toString().trimmed();
-                        int           width    = QtUtils::GetTextWidth(tree_view->font(), textData) + elide_width;
-                        if (width > column_widths[column])
-                        {
-                            column_widths[column] = width;
-                        }
-                    }
-                }
-
                 header->setSectionResizeMode(QHeaderView::Interactive);
-                for (int column = 0; column < column_count; column++)
-                {
-                    if ((max_width == 0) || ((column_widths[column] + padding) < max_width))
-                    {
-                        tree_view->setColumnWidth(column, column_widths[column] + padding);
-                    }
-                    else
-                    {
-                        tree_view->setColumnWidth(column, max_width);
-                    }
-                }
+                ColumnWidthEngine::ApplyColumnWidths(header, column_widths, padding, max_width);
             }
         }
     }
@@ -160,12 +479,12 @@ namespace QtCommon
         if (header != nullptr)
         {
             header->setSectionResizeMode(QHeaderView::ResizeToContents);
-            const int    column_count = header->count();
-            QVector<int> column_widths(column_count);
 
             QAbstractItemModel* model = (QAbstractItemModel*)table->model();
             if (model != nullptr)
             {
+                const QVector<int> column_widths = ColumnWidthEngine::ComputeColumnWidths(model, header, table->font(), max_rows, padding);
+
                 int     margin = 0;
                 QStyle* style  = header->style();
                 if (style != nullptr)
@@ -173,39 +492,11 @@ namespace QtCommon
                     margin = header->style()->pixelMetric(QStyle::PM_HeaderMargin, 0, header);
                 }
 
-                const int    row_count   = model->rowCount();
-                const int    elide_width = QtUtils::GetTextWidth(table->font(), QString(QChar(0x2026)));
                 QFontMetrics fm(header->font());
                 header->setFixedHeight(fm.height() + (margin * 2));
 
-                for (int column = 0; column < column_count; column++)
-                {
-                    const QVariant header_data = model->headerData(column, Qt::Horizontal);
-                    const QString  text_header = header_data.toString().trimmed();
-                    column_widths[column]      = QtUtils::GetTextWidth(header->font(), text_header) + padding + (margin * 2);
-                    for (int row = 0; (row < row_count) && (row < max_rows); row++)
-                    {
-                        const QString text_data = model->data(model->index(row, column)).toString().trimmed();
-                        int           width     = QtUtils::GetTextWidth(table->font(), text_data) + elide_width;
-                        if (width > column_widths[column])
-                        {
-                            column_widths[column] = width;
-                        }
-                    }
-                }
-
                 header->setSectionResizeMode(QHeaderView::Interactive);
-                for (int column = 0; column < column_count; column++)
-                {
-                    if ((max_width == 0) || ((column_widths[column] + padding) < max_width))
-                    {
-                        table->setColumnWidth(column, column_widths[column] + padding);
-                    }
-                    else
-                    {
-                        table->setColumnWidth(column, max_width);
-                    }
-                }
+                ColumnWidthEngine::ApplyColumnWidths(header, column_widths, padding, max_width);
             }
         }
     }
@@ -218,46 +509,15 @@ namespace QtCommon
         QHeaderView* header = tree_view->header();
         if (header != nullptr)
         {
-            QHeaderView* header_view = tree_view->header();
-            if (header_view != nullptr)
+            QAbstractItemModel* model = (QAbstractItemModel*)tree_view->model();
+            if (model != nullptr)
             {
-                const int    column_count = tree_view->header()->count();
-                QVector<int> column_widths(column_count);
+                const QVector<int> column_widths = ColumnWidthEngine::ComputeColumnWidths(model, header, tree_view->font(), maxRows, padding);
 
-                QAbstractItemModel* model = (QAbstractItemModel*)tree_view->model();
-                if (model != nullptr)
+                // Sum the widths of all visible columns.
+                for (int column_width : column_widths)
                 {
-                    int     margin = 0;
-                    QStyle* style  = header->style();
-                    if (style != nullptr)
-                    {
-                        margin = header->style()->pixelMetric(QStyle::PM_HeaderMargin, 0, header);
-                    }
-
-                    const int row_count   = model->rowCount();
-                    const int elide_width = QtCommon::QtUtils::GetTextWidth(tree_view->font(), QString(QChar(0x2026)));
-
-                    for (int column = 0; column < column_count; column++)
-                    {
-                        QVariant header_data  = model->headerData(column, Qt::Horizontal);
-                        QString  text_header  = header_data.toString().trimmed();
-                        column_widths[column] = QtCommon::QtUtils::GetTextWidth(header->font(), text_header) + padding + (margin * 2);
-                        for (int row = 0; (row < row_count) && (row < maxRows); row++)
-                        {
-                            const QString text_data = model->data(model->index(row, column)).toString().trimmed();
-                            const int     width     = QtCommon::QtUtils::GetTextWidth(tree_view->font(), text_data) + elide_width;
-                            if (width > column_widths[column])
-                            {
-                                column_widths[column] = width;
-                            }
-                        }
-                    }
-
-                    // Sum the widths of all visible columns.
-                    for (int column_width : column_widths)
-                    {
-                        minimum_width += column_width;
-                    }
+                    minimum_width += column_width;
                 }
             }
         }
@@ -271,33 +531,49 @@ namespace QtCommon
 
     void QtUtils::GetFilesizeAcronymFromByteCount(quint64 byte_count, QString& size_string, bool use_round)
     {
-        const float kNumBytesInMegabyte = 1024.0f;
+        QChar     buffer[kFilesizeAcronymBufferSize];
+        const int length = GetFilesizeAcronymFromByteCount(byte_count, buffer, kFilesizeAcronymBufferSize, use_round);
+        size_string.setUnicode(buffer, std::min(length, kFilesizeAcronymBufferSize));
+    }
+
+    int QtUtils::GetFilesizeAcronymFromByteCount(quint64 byte_count, QChar* buffer, int buffer_size, bool use_round)
+    {
+        FixedBufferWriter writer(buffer, buffer_size);
 
-        double scaled_size = byte_count;
+        // Byte counts beyond the largest unit stay in that unit.
+        const int    acronym_index = FilesizeAcronymIndex(byte_count);
+        const int    shift         = acronym_index * 10;
+        const double byte_size     = (double)byte_count;
+        double       scaled_size   = std::ldexp(byte_size, -shift);
 
-        int acronym_index = 0;
-        while (scaled_size >= kNumBytesInMegabyte)
+        if ((scaled_size >= 1024.0) || (FormatScaledByteCount((quint64)byte_size, shift, use_round, writer) == false))
         {
-            scaled_size /= kNumBytesInMegabyte;
-            acronym_index++;
-        }
+            if (use_round == true)
+            {
+                scaled_size = round(scaled_size);
+            }
 
-        if (use_round == true)
-        {
-            scaled_size = round(scaled_size);
+            writer.Append(QString::number(scaled_size, 'g', 4));
         }
 
-        // Catch gigantic filesizes.
-        const QString kSizeAcronym[] = {" B", " KB", " MB", " GB", " TB", " PB"};
-        Q_ASSERT(acronym_index < 6);
+        writer.Append(kSizeAcronyms[acronym_index]);
+        return writer.Length();
+    }
 
-        // Return the abbreviated file size and the unit acronym.
-        size_string = QString::number(scaled_size, 'g', 4) + kSizeAcronym[acronym_index];
+    void QtUtils::GetFilesizeAcronymsFromByteCounts(const quint64* byte_counts, int count, QString* size_strings, bool use_round)
+    {
+        QChar buffer[kFilesizeAcronymBufferSize];
+        for (int i = 0; i < count; i++)
+        {
+            // Reuses the string's storage when it is large enough and not shared.
+            const int length = GetFilesizeAcronymFromByteCount(byte_counts[i], buffer, kFilesizeAcronymBufferSize, use_round);
+            size_strings[i].setUnicode(buffer, std::min(length, kFilesizeAcronymBufferSize));
+        }
     }
 
     int QtUtils::GetTextWidth(const QFont& font, const QString& str)
     {
-        return QFontMetrics(font).boundingRect(str).width();
+        return TextWidthCache::Get().Width(font, str);
     }
 
     int QtUtils::GetPainterTextWidth(QPainter* pPainter, const QString& str)
@@ -317,6 +593,10 @@ namespace QtCommon
     {
         if (widget != nullptr)
         {
+            // Cached text widths may no longer match the new metrics.
+            TextWidthCache::Get().Clear();
+            ColumnWidthEngine::ClearCache();
+
             // Invalidate font and fontmetrics by toggling the font size.
             QFont tmp_font            = widget->font();
             qreal original_point_size = tmp_font.pointSizeF();
@@ -331,6 +611,10 @@ namespace QtCommon
     {
         if (scene != nullptr)
         {
+            // Cached text widths may no longer match the new metrics.
+            TextWidthCache::Get().Clear();
+            ColumnWidthEngine::ClearCache();
+
             // Invalidate font and fontmetrics by toggling the font size.
             QFont tmp_font            = scene->font();
             qreal original_point_size = tmp_font.pointSizeF();
@@ -366,72 +650,50 @@ namespace QtCommon
         return result;
     }
 
-    QString QtUtils::ClockToTimeUnit(double clk, int unit_type)
+    int QtUtils::ClockToTimeUnit(double clk, int unit_type, QChar* buffer, int buffer_size)
     {
-        double time = clk;
-
-        QString     str = "";
-        QTextStream out(&str);
-        out.setRealNumberNotation(QTextStream::FixedNotation);
-        out.setLocale(QLocale::English);
-
-        switch (unit_type)
+        FixedBufferWriter writer(buffer, buffer_size);
+        if (clk >= 0 && clk <= kMaxIntegerFormatClock && std::signbit(clk) == false && std::floor(clk) == clk)
         {
-        case kTimeUnitTypeNanosecond:
-            out.setRealNumberPrecision(0);
-            out << time << " ns";
-            break;
+            if (FormatIntegerClock((quint64)clk, unit_type, writer) == true)
+            {
+                return writer.Length();
+            }
+        }
 
-        case kTimeUnitTypeMicrosecond:
-            time /= 1000.0;
-            out.setRealNumberPrecision(3);
-            out << time << QString(u8" μs");
-            break;
+        writer.Append(StreamClockToTimeUnit(clk, unit_type));
 
-        case kTimeUnitTypeMillisecond:
-            out.setRealNumberPrecision(3);
-            time /= 1000000.0;
-            out << time << " ms";
-            break;
+        return writer.Length();
+    }
 
-        case kTimeUnitTypeSecond:
+    QString QtUtils::ClockToTimeUnit(double clk, int unit_type)
+    {
+        QChar     buffer[kTimeUnitBufferSize];
+        const int length = ClockToTimeUnit(clk, unit_type, buffer, kTimeUnitBufferSize);
+        if (length <= kTimeUnitBufferSize)
         {
-            out.setRealNumberPrecision(0);
-            uint64_t secs = (uint64_t)(time / 1000000000.0);
-            uint64_t ms   = (uint64_t)fmod((time / 10000000.0), 100);
-            out << QString::number(secs).rightJustified(2, '0') << "." << QString::number(ms).rightJustified(2, '0') << "s";
+            return QString(buffer, length);
         }
-        break;
 
-        case kTimeUnitTypeMinute:
-        {
-            out.setRealNumberPrecision(0);
-            uint64_t mins = (uint64_t)(time / 60000000000.0);
-            uint64_t secs = (uint64_t)fmod((time / 1000000000.0), 60);
-            uint64_t ms   = (uint64_t)fmod((time / 10000000.0), 100);
-            out << mins << "m " << QString::number(secs).rightJustified(2, '0') << "." << QString::number(ms).rightJustified(2, '0') << "s";
-        }
-        break;
+        return StreamClockToTimeUnit(clk, unit_type);
+    }
 
-        case kTimeUnitTypeHour:
+    void QtUtils::ClockToTimeUnit(const double* clks, int count, int unit_type, QString* strings)
+    {
+        QChar buffer[kTimeUnitBufferSize];
+        for (int i = 0; i < count; i++)
         {
-            out.setRealNumberPrecision(0);
-            uint64_t hours    = static_cast<uint64_t>(time / (60 * 60 * 1000000000.0));
-            uint64_t mins     = static_cast<uint64_t>(fmod((time / (60 * 1000000000.0)), 60));
-            uint64_t secs     = static_cast<uint64_t>(fmod((time / 1000000000.0), 60));
-            uint64_t fraction = static_cast<uint64_t>(fmod((time / 10000.0), 100000));
-            out << hours << ":" << QString::number(mins).rightJustified(2, '0') << ":" << QString::number(secs).rightJustified(2, '0') << "."
-                << QString::number(fraction).leftJustified(5, '0');
-        }
-        break;
-
-        case kTimeUnitTypeClk:
-        default:
-            out << (quint64)clk << " clk";
-            break;
+            const int length = ClockToTimeUnit(clks[i], unit_type, buffer, kTimeUnitBufferSize);
+            if (length <= kTimeUnitBufferSize)
+            {
+                // Reuses the string's storage when it is large enough and not shared.
+                strings[i].setUnicode(buffer, length);
+            }
+            else
+            {
+                strings[i] = StreamClockToTimeUnit(clks[i], unit_type);
+            }
         }
-
-        return str;
     }
 
     QString QtUtils::HashToStr(quint64 value)
@@ -544,11 +806,16 @@ namespace QtCommon
         return theme_type_;
     }
 
-    DefaultThemeColors QtUtils::ColorTheme::GetCurrentThemeColors()
+    const DefaultThemeColors& QtUtils::ColorTheme::GetCurrentThemeColors() const
     {
         return theme_colors_[theme_type_];
     }
 
+    quint64 QtUtils::ColorTheme::GetThemeGeneration() const
+    {
+        return generation_;
+    }
+
     QPalette QtUtils::ColorTheme::GetCurrentPalette()
     {
         return palette_[theme_type_];
@@ -556,10 +823,15 @@ namespace QtCommon
 
     void QtUtils::ColorTheme::SetColorTheme(ColorThemeType color_theme)
     {
-        theme_type_ = color_theme;
+        if (color_theme != theme_type_)
+        {
+            theme_type_ = color_theme;
+            generation_++;
+        }
     }
 
     QtUtils::ColorTheme::ColorTheme()
+        : generation_(0)
     {
         theme_colors_[kColorThemeTypeLight].graphics_scene_text_color          = Qt::black;
         theme_colors_[kColorThemeTypeLight].link_text_color                    = QColor(0, 0, 255);
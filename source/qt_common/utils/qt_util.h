@@ -8,6 +8,7 @@
 #ifndef QTCOMMON_UTILS_QT_UTIL_H_
 #define QTCOMMON_UTILS_QT_UTIL_H_
 
+#include <algorithm>
 #include <vector>
 
 #include <QtGlobal>
@@ -63,6 +64,42 @@ namespace QtCommon
         /// \param use_round If true, round the value to the nearest integer.
         void GetFilesizeAcronymFromByteCount(quint64 byte_count, QString& size_string, bool use_round = false);
 
+        /// The buffer size needed by GetFilesizeAcronymFromByteCount to format any byte count.
+        static const int kFilesizeAcronymBufferSize = 32;
+
+        /// Compute the file size acronym for the given byte count into a caller-provided buffer,
+        /// without allocating.
+        /// \param byte_count The number of bytes to compute the size acronym for.
+        /// \param buffer Receives the characters. The text is not null-terminated.
+        /// \param buffer_size The capacity of the buffer, in characters.
+        /// \param use_round If true, round the value to the nearest integer.
+        /// \return The length of the text. If this is larger than buffer_size, the text was truncated.
+        int GetFilesizeAcronymFromByteCount(quint64 byte_count, QChar* buffer, int buffer_size, bool use_round = false);
+
+        /// Compute the file size acronyms for a list of byte counts, reusing the storage of the output strings.
+        /// \param byte_counts The byte counts.
+        /// \param count The number of byte counts.
+        /// \param size_strings Receives a string with the file size acronym for each byte count.
+        /// \param use_round If true, round the values to the nearest integer.
+        void GetFilesizeAcronymsFromByteCounts(const quint64* byte_counts, int count, QString* size_strings, bool use_round = false);
+
+        /// Compute the file size acronyms for a list of byte counts, passing each one to a visitor
+        /// rather than storing it. The text is only valid for the duration of the visitor call.
+        /// \param byte_counts The byte counts.
+        /// \param count The number of byte counts.
+        /// \param use_round If true, round the values to the nearest integer.
+        /// \param visitor Called as visitor(index, text, length) for each byte count.
+        template <typename Visitor>
+        void VisitFilesizeAcronyms(const quint64* byte_counts, int count, bool use_round, Visitor&& visitor)
+        {
+            QChar buffer[kFilesizeAcronymBufferSize];
+            for (int i = 0; i < count; i++)
+            {
+                const int length = GetFilesizeAcronymFromByteCount(byte_counts[i], buffer, kFilesizeAcronymBufferSize, use_round);
+                visitor(i, static_cast<const QChar*>(buffer), std::min(length, kFilesizeAcronymBufferSize));
+            }
+        }
+
         /// Calculate the pixel width of a string
         /// \param font The font to measure
         /// \param str The string to measure
@@ -101,6 +138,29 @@ namespace QtCommon
         /// \return a string representing a clock value
         QString ClockToTimeUnit(double clk, int unit_type);
 
+        /// The buffer size used by ClockToTimeUnit to format a clock without allocating. It holds the text
+        /// of any non-negative integral clock up to 2^50. Other clocks, such as very large or fractional
+        /// values, can need more; the buffer overload then returns a larger length, and the QString
+        /// overloads fall back to formatting through a stream.
+        static const int kTimeUnitBufferSize = 48;
+
+        /// Convert a clock to a time unit, writing the same text as ClockToTimeUnit(double, int)
+        /// into a caller-provided buffer. Non-negative integral clocks up to 2^50 are formatted
+        /// with integer arithmetic and without allocating.
+        /// \param clk input clock to convert
+        /// \param unit_type unit type (clk, ns, us, ms)
+        /// \param buffer Receives the characters. The text is not null-terminated.
+        /// \param buffer_size The capacity of the buffer, in characters.
+        /// \return The length of the text. If this is larger than buffer_size, the text was truncated.
+        int ClockToTimeUnit(double clk, int unit_type, QChar* buffer, int buffer_size);
+
+        /// Convert a column of clocks to a time unit, reusing the storage of the output strings.
+        /// \param clks The clocks to convert.
+        /// \param count The number of clocks.
+        /// \param unit_type unit type (clk, ns, us, ms)
+        /// \param strings Receives a string for each clock.
+        void ClockToTimeUnit(const double* clks, int count, int unit_type, QString* strings);
+
         /// Utility function to convert a uint64 value to capitalized and aligned str
         /// \param value 64-bit value
         /// \return a string representation of the value
@@ -140,7 +200,12 @@ namespace QtCommon
 
             /// \brief Get a container of commonly used colors based on the current color theme.
             /// \return The container of commonly used colors.
-            DefaultThemeColors GetCurrentThemeColors();
+            const DefaultThemeColors& GetCurrentThemeColors() const;
+
+            /// \brief Get the theme generation, which is incremented each time the color theme changes.
+            /// Paint code can compare it against a stored value to know when to rebuild cached pens and brushes.
+            /// \return The theme generation.
+            quint64 GetThemeGeneration() const;
 
             /// \brief Get a QPalette based on the current color theme.
             /// \return The palette for the current color theme.
@@ -167,6 +232,7 @@ namespace QtCommon
             ColorThemeType     theme_type_;                          ///< Holds the current color theme value.
             DefaultThemeColors theme_colors_[kColorThemeTypeCount];  ///< Array of commonly used colors with a value for each color theme.
             QPalette           palette_[kColorThemeTypeCount];       ///< Array of palettes for each color theme.
+            quint64            generation_;                          ///< Incremented each time the color theme changes.
         };
 
     }  // namespace QtUtils
@@ -0,0 +1,157 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of the StyleSheetRegistry.
+//=============================================================================
+
+#include "style_sheet_registry.h"
+
+#include <QElapsedTimer>
+#include <QWidget>
+
+#include "qt_util.h"
+
+/// The maximum number of distinct style sheets shared before the shared copies are released.
+static const int kMaxSharedStyleSheets = 1024;
+
+StyleSheetRegistry& StyleSheetRegistry::Get()
+{
+    static StyleSheetRegistry instance;
+    return instance;
+}
+
+StyleSheetRegistry::StyleSheetRegistry()
+{
+    connect(&QtCommon::QtUtils::ColorTheme::Get(), &QtCommon::QtUtils::ColorTheme::ColorThemeUpdated, this, &StyleSheetRegistry::ApplyAll);
+}
+
+StyleSheetRegistry::~StyleSheetRegistry()
+{
+}
+
+QString StyleSheetRegistry::Intern(const QString& style_sheet)
+{
+    auto shared_style_sheet = style_sheets_.constFind(style_sheet);
+    if (shared_style_sheet == style_sheets_.constEnd())
+    {
+        if (style_sheets_.size() >= kMaxSharedStyleSheets)
+        {
+            style_sheets_.clear();
+        }
+
+        shared_style_sheet = style_sheets_.insert(style_sheet);
+    }
+
+    return *shared_style_sheet;
+}
+
+bool StyleSheetRegistry::Apply(QWidget* widget, const QString& style_sheet)
+{
+    if (widget == nullptr || widget->styleSheet() == style_sheet)
+    {
+        return false;
+    }
+
+    widget->setStyleSheet(Intern(style_sheet));
+    return true;
+}
+
+bool StyleSheetRegistry::AppendRule(QWidget* widget, const QString& rule)
+{
+    if (widget == nullptr || widget->styleSheet().contains(rule) == true)
+    {
+        return false;
+    }
+
+    return Apply(widget, widget->styleSheet() + rule);
+}
+
+void StyleSheetRegistry::Register(QWidget* widget, const StyleSheetFunction& style_sheet_function, bool always_reapply)
+{
+    if (widget == nullptr || style_sheet_function == nullptr)
+    {
+        return;
+    }
+
+    Unregister(widget);
+
+    Entry entry;
+    entry.style_sheet_function = style_sheet_function;
+    entry.always_reapply       = always_reapply;
+    entry.destroyed_connection = connect(widget, &QObject::destroyed, this, [this, widget]() { entries_.remove(widget); });
+    entries_.insert(widget, entry);
+
+    Apply(widget, style_sheet_function());
+}
+
+void StyleSheetRegistry::Unregister(QWidget* widget)
+{
+    const auto entry = entries_.constFind(widget);
+    if (entry != entries_.constEnd())
+    {
+        disconnect(entry->destroyed_connection);
+        entries_.erase(entry);
+    }
+}
+
+void StyleSheetRegistry::Refresh(QWidget* widget)
+{
+    const auto entry = entries_.constFind(widget);
+    if (entry != entries_.constEnd())
+    {
+        Apply(widget, entry->style_sheet_function());
+    }
+}
+
+void StyleSheetRegistry::SetTimingHook(const TimingHook& timing_hook)
+{
+    timing_hook_ = timing_hook;
+}
+
+void StyleSheetRegistry::ApplyAll()
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    // Suspend updates on every affected window so that nothing is repainted until all
+    // style sheets have been applied.
+    QSet<QWidget*> suspended_windows;
+    for (auto entry = entries_.constBegin(); entry != entries_.constEnd(); ++entry)
+    {
+        QWidget* window = entry.key()->window();
+        if (window->updatesEnabled() == true && suspended_windows.contains(window) == false)
+        {
+            window->setUpdatesEnabled(false);
+            suspended_windows.insert(window);
+        }
+    }
+
+    int applied_count = 0;
+    for (auto entry = entries_.constBegin(); entry != entries_.constEnd(); ++entry)
+    {
+        QWidget*      widget      = entry.key();
+        const QString style_sheet = entry->style_sheet_function();
+
+        if (entry->always_reapply == true && widget->styleSheet() == style_sheet)
+        {
+            // Setting the same style sheet again re-polishes the widget, so palette colors are resolved again.
+            widget->setStyleSheet(Intern(style_sheet));
+            applied_count++;
+        }
+        else if (Apply(widget, style_sheet) == true)
+        {
+            applied_count++;
+        }
+    }
+
+    for (QWidget* window : suspended_windows)
+    {
+        window->setUpdatesEnabled(true);
+    }
+
+    if (timing_hook_ != nullptr)
+    {
+        timing_hook_(entries_.size(), applied_count, timer.nsecsElapsed());
+    }
+}
@@ -0,0 +1,104 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for the StyleSheetRegistry.
+//=============================================================================
+
+#ifndef QTCOMMON_UTILS_STYLE_SHEET_REGISTRY_H_
+#define QTCOMMON_UTILS_STYLE_SHEET_REGISTRY_H_
+
+#include <functional>
+
+#include <QHash>
+#include <QMetaObject>
+#include <QObject>
+#include <QSet>
+#include <QString>
+
+class QWidget;
+
+/// Class that owns the style sheets applied to widgets.
+///
+/// Identical style sheet text is shared between widgets, and a style sheet is only
+/// re-applied, and so re-parsed, when its text changes. Widgets whose style sheet
+/// depends on the color theme are registered with a function that builds it; when
+/// the color theme is updated, all of them are re-applied in a single pass with
+/// updates suspended on their windows.
+class StyleSheetRegistry : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// Function that builds a widget's style sheet for the current color theme.
+    typedef std::function<QString()> StyleSheetFunction;
+
+    /// Function called after the registered style sheets have been re-applied.
+    /// The arguments are the number of registered widgets, the number of style
+    /// sheets that changed, and the time taken in nanoseconds.
+    typedef std::function<void(int, int, qint64)> TimingHook;
+
+    /// StyleSheetRegistry instance get function.
+    /// \return a reference to the StyleSheetRegistry instance.
+    static StyleSheetRegistry& Get();
+
+    /// Set a widget's style sheet, unless it already has the same one.
+    /// \param widget The widget.
+    /// \param style_sheet The style sheet.
+    /// \return true if the style sheet was applied, false if it was unchanged.
+    bool Apply(QWidget* widget, const QString& style_sheet);
+
+    /// Append a rule to a widget's style sheet, unless the style sheet already contains it.
+    /// \param widget The widget.
+    /// \param rule The rule to append.
+    /// \return true if the rule was appended, false if it was already present.
+    bool AppendRule(QWidget* widget, const QString& rule);
+
+    /// Register a widget whose style sheet depends on the color theme, and apply it now.
+    /// The widget is unregistered automatically when it is destroyed.
+    /// \param widget The widget.
+    /// \param style_sheet_function Builds the widget's style sheet for the current color theme.
+    /// \param always_reapply If true, the style sheet is re-applied on theme changes even if
+    /// its text is unchanged. Needed for style sheets that refer to palette colors.
+    void Register(QWidget* widget, const StyleSheetFunction& style_sheet_function, bool always_reapply = false);
+
+    /// Stop tracking a widget. Its current style sheet is left in place.
+    /// \param widget The widget.
+    void Unregister(QWidget* widget);
+
+    /// Re-apply the style sheet of a registered widget.
+    /// \param widget The widget.
+    void Refresh(QWidget* widget);
+
+    /// Set the function to call each time the registered style sheets are re-applied.
+    /// \param timing_hook The function, or nullptr to remove it.
+    void SetTimingHook(const TimingHook& timing_hook);
+
+public slots:
+    /// Re-apply the style sheets of all registered widgets in one pass.
+    void ApplyAll();
+
+private:
+    /// Constructor/destructor is private for singleton
+    StyleSheetRegistry();
+    ~StyleSheetRegistry();
+
+    /// Get the shared copy of a style sheet.
+    /// \param style_sheet The style sheet.
+    /// \return A copy sharing its data with all other identical style sheets.
+    QString Intern(const QString& style_sheet);
+
+    /// A registered widget.
+    struct Entry
+    {
+        StyleSheetFunction      style_sheet_function;  ///< Builds the widget's style sheet.
+        bool                    always_reapply;        ///< Whether to re-apply unchanged style sheets.
+        QMetaObject::Connection destroyed_connection;  ///< Unregisters the widget when it is destroyed.
+    };
+
+    QHash<QWidget*, Entry> entries_;       ///< The registered widgets.
+    QSet<QString>          style_sheets_;  ///< The shared copies of all applied style sheets.
+    TimingHook             timing_hook_;   ///< Called after the style sheets are re-applied.
+};
+
+#endif  // QTCOMMON_UTILS_STYLE_SHEET_REGISTRY_H_
@@ -0,0 +1,148 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of a trigram index used to filter lists of strings as the user types.
+//=============================================================================
+
+#include "text_filter_index.h"
+
+#include <numeric>
+
+TextFilterIndex::TextFilterIndex()
+{
+}
+
+TextFilterIndex::~TextFilterIndex()
+{
+}
+
+void TextFilterIndex::Build(const QStringList& texts)
+{
+    Clear();
+
+    lower_texts_.reserve(texts.size());
+    for (int row = 0; row < texts.size(); row++)
+    {
+        const QString lower_text = texts[row].toLower();
+        lower_texts_.append(lower_text);
+
+        for (int i = 0; i + 2 < lower_text.size(); i++)
+        {
+            QVector<int>& rows = trigrams_[TrigramKey(lower_text.constData() + i)];
+
+            // A string can contain a trigram more than once, but its row is only listed once.
+            if (rows.isEmpty() == true || rows.last() != row)
+            {
+                rows.append(row);
+            }
+        }
+    }
+
+    MatchAll();
+}
+
+void TextFilterIndex::Clear()
+{
+    lower_texts_.clear();
+    trigrams_.clear();
+    filter_.clear();
+    matches_.clear();
+}
+
+int TextFilterIndex::Size() const
+{
+    return lower_texts_.size();
+}
+
+const QVector<int>& TextFilterIndex::Match(const QString& filter)
+{
+    const QString lower_filter = filter.toLower();
+
+    if (lower_filter.isEmpty() == true)
+    {
+        filter_.clear();
+        MatchAll();
+        return matches_;
+    }
+
+    if (lower_filter == filter_)
+    {
+        return matches_;
+    }
+
+    // Find the smallest list of rows that holds every match. If the new filter contains the previous
+    // one, every match is also a previous match.
+    const QVector<int>* candidates = nullptr;
+    if (filter_.isEmpty() == false && lower_filter.contains(filter_) == true)
+    {
+        candidates = &matches_;
+    }
+
+    // Every match also contains each trigram of the filter, so the rows listed for any one of them will do.
+    for (int i = 0; i + 2 < lower_filter.size(); i++)
+    {
+        const auto trigram_rows = trigrams_.constFind(TrigramKey(lower_filter.constData() + i));
+        if (trigram_rows == trigrams_.constEnd())
+        {
+            // No string contains this trigram, so no string contains the filter.
+            filter_ = lower_filter;
+            matches_.clear();
+            return matches_;
+        }
+
+        if (candidates == nullptr || trigram_rows->size() < candidates->size())
+        {
+            candidates = &(*trigram_rows);
+        }
+    }
+
+    QVector<int> matches;
+    if (candidates != nullptr)
+    {
+        for (const int row : *candidates)
+        {
+            if (lower_texts_[row].contains(lower_filter) == true)
+            {
+                matches.append(row);
+            }
+        }
+    }
+    else
+    {
+        // Filters shorter than a trigram with nothing to narrow down have to check every string.
+        for (int row = 0; row < lower_texts_.size(); row++)
+        {
+            if (lower_texts_[row].contains(lower_filter) == true)
+            {
+                matches.append(row);
+            }
+        }
+    }
+
+    filter_ = lower_filter;
+    matches_.swap(matches);
+
+    return matches_;
+}
+
+const QVector<int>& TextFilterIndex::Matches() const
+{
+    return matches_;
+}
+
+const QString& TextFilterIndex::Filter() const
+{
+    return filter_;
+}
+
+quint64 TextFilterIndex::TrigramKey(const QChar* chars)
+{
+    return (static_cast<quint64>(chars[0].unicode()) << 32) | (static_cast<quint64>(chars[1].unicode()) << 16) | chars[2].unicode();
+}
+
+void TextFilterIndex::MatchAll()
+{
+    matches_.resize(lower_texts_.size());
+    std::iota(matches_.begin(), matches_.end(), 0);
+}
@@ -0,0 +1,71 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for a trigram index used to filter lists of strings as the user types.
+//=============================================================================
+
+#ifndef QTCOMMON_UTILS_TEXT_FILTER_INDEX_H_
+#define QTCOMMON_UTILS_TEXT_FILTER_INDEX_H_
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/// Class that finds the strings of a list containing a filter string, ignoring case.
+///
+/// Building the index lowers each string once and records which strings contain each
+/// trigram (run of 3 characters). A filter of 3 or more characters then only needs to
+/// check the strings listed for its rarest trigram. When a filter contains the previous
+/// filter, as it does while the user types, only the previous matches are checked.
+class TextFilterIndex
+{
+public:
+    /// Constructor.
+    TextFilterIndex();
+
+    /// Destructor.
+    ~TextFilterIndex();
+
+    /// Build the index for a list of strings, replacing any previous index.
+    /// The filter is reset so that every string matches.
+    /// \param texts The strings to index. The index of a string in this list is its row.
+    void Build(const QStringList& texts);
+
+    /// Remove all strings from the index.
+    void Clear();
+
+    /// Get the number of indexed strings.
+    /// \return The string count.
+    int Size() const;
+
+    /// Find the strings containing a filter, ignoring case.
+    /// \param filter The filter. An empty filter matches every string.
+    /// \return The rows of the matching strings, in increasing order.
+    const QVector<int>& Match(const QString& filter);
+
+    /// Get the rows matched by the last call to Match().
+    /// \return The rows of the matching strings, in increasing order.
+    const QVector<int>& Matches() const;
+
+    /// Get the filter of the last call to Match(), in lowercase.
+    /// \return The filter.
+    const QString& Filter() const;
+
+private:
+    /// Get the key of the trigram starting at a character.
+    /// \param chars The first character of the trigram; the two characters after it must exist.
+    /// \return The key.
+    static quint64 TrigramKey(const QChar* chars);
+
+    /// Set the matches to every row.
+    void MatchAll();
+
+    QVector<QString>             lower_texts_;  ///< The indexed strings, in lowercase.
+    QHash<quint64, QVector<int>> trigrams_;     ///< The rows containing each trigram, in increasing order.
+    QString                      filter_;       ///< The last filter, in lowercase.
+    QVector<int>                 matches_;      ///< The rows matching the last filter, in increasing order.
+};
+
+#endif  // QTCOMMON_UTILS_TEXT_FILTER_INDEX_H_
@@ -0,0 +1,376 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Implementation of the shared text width measurement cache.
+//=============================================================================
+
+#include "text_width_cache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+#include <QFontMetrics>
+#include <QFontMetricsF>
+#include <QGlyphRun>
+#include <QTextLayout>
+
+#include "scaling_manager.h"
+
+/// The number of characters covered by the flat glyph table.
+static const int kLatin1CharacterCount = 256;
+
+/// The maximum number of fonts cached before all tables are discarded.
+static const int kMaxCachedFonts = 64;
+
+/// Flag set in a packed pair entry once the pair has been measured.
+static const quint64 kPairMeasured = 1;
+
+/// Flag set in a packed pair entry if the font joins the pair into a ligature.
+static const quint64 kPairLigature = 2;
+
+/// The horizontal metrics of a single glyph.
+struct GlyphMetrics
+{
+    qreal advance;  ///< The distance to the next pen position.
+    qreal left;     ///< The left edge of the glyph's ink, relative to the pen position.
+    qreal right;    ///< The right edge of the glyph's ink, relative to the pen position.
+};
+
+/// The metrics of a pair of neighboring characters.
+struct PairMetrics
+{
+    qreal kerning;   ///< The adjustment applied to the pen position before the second character.
+    bool  ligature;  ///< Whether the font joins the pair into a single glyph.
+};
+
+struct TextWidthCache::FontTable
+{
+    /// Constructor. Fills the Latin-1 table, which is never modified afterwards.
+    /// \param table_font The font.
+    explicit FontTable(const QFont& table_font)
+        : font(table_font)
+        , use_glyph_metrics(table_font.letterSpacing() == 0 && table_font.wordSpacing() == 0 && table_font.capitalization() == QFont::MixedCase)
+    {
+        for (int i = 0; i < kLatin1CharacterCount; i++)
+        {
+            latin1_pairs[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        if (use_glyph_metrics == true)
+        {
+            const QFontMetricsF metrics(font);
+            for (int i = 0; i < kLatin1CharacterCount; i++)
+            {
+                latin1_glyphs[i] = Measure(metrics, QChar(i));
+            }
+        }
+    }
+
+    /// Destructor.
+    ~FontTable()
+    {
+        for (int i = 0; i < kLatin1CharacterCount; i++)
+        {
+            delete[] latin1_pairs[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    /// Measure a single glyph.
+    /// \param metrics The font metrics.
+    /// \param character The character.
+    /// \return The glyph metrics.
+    static GlyphMetrics Measure(const QFontMetricsF& metrics, QChar character)
+    {
+        const QRectF bounds = metrics.boundingRect(character);
+        return {metrics.horizontalAdvance(character), bounds.left(), bounds.right()};
+    }
+
+    /// Pack pair metrics into a single value that can be stored atomically.
+    /// \param pair The pair metrics.
+    /// \return The packed metrics. This is never 0.
+    static quint64 PackPair(const PairMetrics& pair)
+    {
+        const float kerning      = (float)pair.kerning;
+        quint32     kerning_bits = 0;
+        std::memcpy(&kerning_bits, &kerning, sizeof(kerning_bits));
+
+        return ((quint64)kerning_bits << 32) | kPairMeasured | (pair.ligature == true ? kPairLigature : 0);
+    }
+
+    /// Unpack pair metrics packed by PackPair().
+    /// \param packed The packed metrics.
+    /// \return The pair metrics.
+    static PairMetrics UnpackPair(quint64 packed)
+    {
+        const quint32 kerning_bits = (quint32)(packed >> 32);
+        float         kerning      = 0;
+        std::memcpy(&kerning, &kerning_bits, sizeof(kerning));
+
+        return {kerning, (packed & kPairLigature) != 0};
+    }
+
+    /// Get the metrics of a glyph.
+    /// \param character The character.
+    /// \return The glyph metrics.
+    GlyphMetrics Glyph(QChar character)
+    {
+        if (character.unicode() < kLatin1CharacterCount)
+        {
+            return latin1_glyphs[character.unicode()];
+        }
+
+        {
+            QReadLocker locker(&lock);
+            const auto  glyph = other_glyphs.constFind(character.unicode());
+            if (glyph != other_glyphs.constEnd())
+            {
+                return glyph.value();
+            }
+        }
+
+        // Measure without holding the lock. Another thread measuring the same glyph gets the same result.
+        const GlyphMetrics glyph = Measure(QFontMetricsF(font), character);
+
+        QWriteLocker locker(&lock);
+        other_glyphs.insert(character.unicode(), glyph);
+        return glyph;
+    }
+
+    /// Measure a pair of characters.
+    /// \param first The first character.
+    /// \param second The second character.
+    /// \return The pair metrics.
+    PairMetrics MeasurePair(QChar first, QChar second)
+    {
+        const QString pair_text = QString(first) + second;
+
+        // A ligature shapes the pair into fewer glyphs than characters.
+        QTextLayout layout(pair_text, font);
+        layout.beginLayout();
+        layout.createLine();
+        layout.endLayout();
+
+        int glyph_count = 0;
+        for (const QGlyphRun& glyph_run : layout.glyphRuns())
+        {
+            glyph_count += (int)glyph_run.glyphIndexes().size();
+        }
+
+        const qreal pair_advance = QFontMetricsF(font).horizontalAdvance(pair_text);
+        return {pair_advance - Glyph(first).advance - Glyph(second).advance, glyph_count < pair_text.size()};
+    }
+
+    /// Get the metrics of a pair of neighboring characters.
+    /// \param first The first character.
+    /// \param second The second character.
+    /// \return The pair metrics.
+    PairMetrics Pair(QChar first, QChar second)
+    {
+        if (first.unicode() < kLatin1CharacterCount && second.unicode() < kLatin1CharacterCount)
+        {
+            // Latin-1 pairs are stored in a row per first character, allocated on first use. Every entry is
+            // a single atomic value, so no lock is needed.
+            std::atomic<quint64>* row = latin1_pairs[first.unicode()].load(std::memory_order_acquire);
+            if (row == nullptr)
+            {
+                std::atomic<quint64>* new_row = new std::atomic<quint64>[kLatin1CharacterCount];
+                for (int i = 0; i < kLatin1CharacterCount; i++)
+                {
+                    new_row[i].store(0, std::memory_order_relaxed);
+                }
+
+                if (latin1_pairs[first.unicode()].compare_exchange_strong(row, new_row, std::memory_order_acq_rel) == true)
+                {
+                    row = new_row;
+                }
+                else
+                {
+                    // Another thread added the row first, and row now holds it.
+                    delete[] new_row;
+                }
+            }
+
+            quint64 packed = row[second.unicode()].load(std::memory_order_relaxed);
+            if (packed == 0)
+            {
+                packed = PackPair(MeasurePair(first, second));
+                row[second.unicode()].store(packed, std::memory_order_relaxed);
+            }
+
+            return UnpackPair(packed);
+        }
+
+        const quint32 key = (quint32(first.unicode()) << 16) | second.unicode();
+        {
+            QReadLocker locker(&lock);
+            const auto  pair = other_pairs.constFind(key);
+            if (pair != other_pairs.constEnd())
+            {
+                return pair.value();
+            }
+        }
+
+        const PairMetrics pair = MeasurePair(first, second);
+
+        QWriteLocker locker(&lock);
+        other_pairs.insert(key, pair);
+        return pair;
+    }
+
+    const QFont                        font;                                  ///< The font.
+    const bool                         use_glyph_metrics;                     ///< Whether strings can be measured from glyph metrics.
+    GlyphMetrics                       latin1_glyphs[kLatin1CharacterCount];  ///< The Latin-1 glyph metrics. Read without locking.
+    std::atomic<std::atomic<quint64>*> latin1_pairs[kLatin1CharacterCount];   ///< Packed Latin-1 pair metrics, per first character.
+    QHash<ushort, GlyphMetrics>        other_glyphs;                          ///< The metrics of other measured glyphs.
+    QHash<quint32, PairMetrics>        other_pairs;                           ///< The metrics of other measured pairs.
+    QReadWriteLock                     lock;                                  ///< Guards other_glyphs and other_pairs.
+};
+
+TextWidthCache& TextWidthCache::Get()
+{
+    static TextWidthCache instance;
+    return instance;
+}
+
+TextWidthCache::TextWidthCache()
+{
+    QObject::connect(&ScalingManager::Get(), &ScalingManager::ScaleFactorChanged, [this]() { Clear(); });
+}
+
+TextWidthCache::~TextWidthCache()
+{
+}
+
+bool TextWidthCache::IsSimpleText(const QString& text)
+{
+    for (const QChar character : text)
+    {
+        const ushort code = character.unicode();
+
+        // Printable ASCII is by far the common case.
+        if (code >= 0x20 && code < 0x7f)
+        {
+            continue;
+        }
+
+        // Control characters, the soft hyphen and surrogate pairs all need shaping.
+        if (code < 0x20 || (code >= 0x7f && code < 0xa0) || code == 0xad || character.isSurrogate() == true)
+        {
+            return false;
+        }
+
+        if (character.isMark() == true || character.isPrint() == false)
+        {
+            return false;
+        }
+
+        switch (character.direction())
+        {
+        case QChar::DirL:
+        case QChar::DirEN:
+        case QChar::DirES:
+        case QChar::DirET:
+        case QChar::DirCS:
+        case QChar::DirWS:
+        case QChar::DirON:
+            break;
+
+        default:
+            return false;
+        }
+
+        switch (character.script())
+        {
+        case QChar::Script_Common:
+        case QChar::Script_Latin:
+        case QChar::Script_Greek:
+        case QChar::Script_Cyrillic:
+            break;
+
+        default:
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::shared_ptr<TextWidthCache::FontTable> TextWidthCache::GetFontTable(const QFont& font)
+{
+    {
+        QReadLocker locker(&lock_);
+        const auto  table = font_tables_.constFind(font);
+        if (table != font_tables_.constEnd())
+        {
+            return table.value();
+        }
+    }
+
+    std::shared_ptr<FontTable> table = std::make_shared<FontTable>(font);
+
+    QWriteLocker locker(&lock_);
+    if (font_tables_.size() >= kMaxCachedFonts)
+    {
+        font_tables_.clear();
+    }
+
+    // Another thread may have added the same font in the meantime.
+    const auto existing_table = font_tables_.constFind(font);
+    if (existing_table != font_tables_.constEnd())
+    {
+        return existing_table.value();
+    }
+
+    font_tables_.insert(font, table);
+    return table;
+}
+
+int TextWidthCache::Width(const QFont& font, const QString& text)
+{
+    if (text.isEmpty() == true)
+    {
+        return 0;
+    }
+
+    std::shared_ptr<FontTable> table = GetFontTable(font);
+    if (table->use_glyph_metrics == false || IsSimpleText(text) == false)
+    {
+        return QFontMetrics(font).boundingRect(text).width();
+    }
+
+    // Accumulate the ink extents glyph by glyph, the same way the text engine computes a bounding box.
+    qreal pen       = 0;
+    qreal ink_left  = std::numeric_limits<qreal>::max();
+    qreal ink_right = std::numeric_limits<qreal>::lowest();
+
+    for (int i = 0; i < text.size(); i++)
+    {
+        if (i > 0)
+        {
+            const PairMetrics pair = table->Pair(text[i - 1], text[i]);
+            if (pair.ligature == true)
+            {
+                // A ligature's ink can't be built from its characters' glyphs.
+                return QFontMetrics(font).boundingRect(text).width();
+            }
+
+            pen += pair.kerning;
+        }
+
+        const GlyphMetrics glyph = table->Glyph(text[i]);
+        ink_left                 = std::min(ink_left, pen + glyph.left);
+        ink_right                = std::max(ink_right, pen + glyph.right);
+        pen += glyph.advance;
+    }
+
+    return qRound(ink_right - ink_left);
+}
+
+void TextWidthCache::Clear()
+{
+    QWriteLocker locker(&lock_);
+    font_tables_.clear();
+}
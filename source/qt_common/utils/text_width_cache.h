@@ -0,0 +1,73 @@
+//=============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Header for the shared text width measurement cache.
+//=============================================================================
+
+#ifndef QTCOMMON_UTILS_TEXT_WIDTH_CACHE_H_
+#define QTCOMMON_UTILS_TEXT_WIDTH_CACHE_H_
+
+#include <memory>
+
+#include <QFont>
+#include <QHash>
+#include <QReadWriteLock>
+#include <QString>
+
+/// Class that measures text widths from cached per-font glyph metrics.
+///
+/// For each font, the advance and horizontal ink extents of every Latin-1 character are
+/// stored in a flat table, with a hash map for other simple characters. Strings made only
+/// of such characters are measured by walking those tables, so no text layout is needed.
+/// The kerning between each pair of characters, and whether the font joins the pair into a
+/// ligature, is measured once and cached. Strings containing ligatures, complex scripts,
+/// combining marks, bidirectional text or control characters, and fonts using letter spacing
+/// or capitalization, are measured with full text shaping.
+///
+/// The cache is thread-safe. The Latin-1 glyph table is built once per font and read without
+/// locking, and so are the pairs of Latin-1 characters, which are stored as atomic values.
+/// Only the hash maps of other characters and pairs are guarded by a read/write lock, which
+/// is held exclusively just to add a newly measured entry. The cache is cleared when the scale
+/// factor changes.
+class TextWidthCache
+{
+public:
+    /// TextWidthCache instance get function.
+    /// \return a reference to the TextWidthCache instance.
+    static TextWidthCache& Get();
+
+    /// Measure the width of a string, as QFontMetrics::boundingRect(text).width() does.
+    /// Fonts that shape text across more than two characters, for example with contextual
+    /// alternates, can make the cached result differ from a full layout by a pixel or so.
+    /// \param font The font to measure with.
+    /// \param text The string to measure.
+    /// \return The string width, in pixels.
+    int Width(const QFont& font, const QString& text);
+
+    /// Discard the cached metrics of all fonts.
+    void Clear();
+
+    /// Check whether a string can be measured from per-character metrics.
+    /// \param text The string to check.
+    /// \return true if no text shaping is needed to measure the string, false otherwise.
+    static bool IsSimpleText(const QString& text);
+
+private:
+    /// Constructor/destructor is private for singleton
+    TextWidthCache();
+    ~TextWidthCache();
+
+    /// The cached metrics of a single font.
+    struct FontTable;
+
+    /// Get the cached metrics of a font, creating them if needed.
+    /// \param font The font.
+    /// \return The font's metrics.
+    std::shared_ptr<FontTable> GetFontTable(const QFont& font);
+
+    QReadWriteLock                           lock_;         ///< Guards the font tables.
+    QHash<QFont, std::shared_ptr<FontTable>> font_tables_;  ///< The cached metrics, per font.
+};
+
+#endif  // QTCOMMON_UTILS_TEXT_WIDTH_CACHE_H_